@@ -0,0 +1,42 @@
+// Allocation counting for the benches: replaces the global operator new/delete, so include it from exactly one
+// source file per executable (the one with main). s_allocations counts every allocation since startup.
+#pragma once
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<size_t> s_allocations = 0;
+
+void* operator new(size_t size) {
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, std::nothrow_t const&) noexcept {
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](size_t size, std::nothrow_t const& tag) noexcept {
+    return operator new(size, tag);
+}
+
+// every form of delete frees here. not inlined, or GCC sees free() on a pointer from operator new where a
+// new/delete pair got inlined, and warns (-Wmismatched-new-delete)
+[[gnu::noinline]] static void countedFree(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr) noexcept { countedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { countedFree(ptr); }
+void operator delete(void* ptr, std::nothrow_t const&) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr, std::nothrow_t const&) noexcept { countedFree(ptr); }
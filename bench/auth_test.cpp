@@ -0,0 +1,234 @@
+// SpotifyAuth against a stand-in token endpoint (web::MockServer) and redirect server (LocalAuthServer stand-in),
+// plus known-answer checks of the PKCE cryptography. Usage: auth_test
+// Checks the SHA-256 and base64url vectors, that redirects without the state of the authorize URL are refused,
+// that the PKCE exchange sends a verifier matching the challenge and stores the tokens, and that refreshes are
+// shared and rotate the refresh token. Exits with 1 if a check fails.
+#include <managers/httpManager.hpp>
+#include <utils/Crypto.hpp>
+#include <LocalAuthServer.hpp>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static size_t s_failures = 0;
+
+static void check(bool condition, std::string_view what) {
+    if (!condition) {
+        fmt::print("  FAIL {}\n", what);
+        ++s_failures;
+    }
+}
+
+static web::MockServer& server() {
+    return web::MockServer::get();
+}
+
+static void runMainThread() {
+    Loader::get()->runMainThreadQueue();
+}
+
+static std::string hex(std::span<const uint8_t> bytes) {
+    std::string out;
+    for (auto byte : bytes) out += fmt::format("{:02x}", byte);
+    return out;
+}
+
+static std::span<const uint8_t> bytesOf(std::string_view str) {
+    return {reinterpret_cast<const uint8_t*>(str.data()), str.size()};
+}
+
+/// @brief Values of a query string or form body, still percent-encoded.
+static std::map<std::string, std::string> parseQuery(std::string_view query) {
+    std::map<std::string, std::string> values;
+    if (auto start = query.find('?'); start != std::string_view::npos) query.remove_prefix(start + 1);
+    while (!query.empty()) {
+        auto pair = query.substr(0, query.find('&'));
+        query.remove_prefix(std::min(pair.size() + 1, query.size()));
+        auto eq = pair.find('=');
+        values.emplace(pair.substr(0, eq), eq == std::string_view::npos ? "" : pair.substr(eq + 1));
+    }
+    return values;
+}
+
+static void testSha256() {
+    fmt::print("sha256\n");
+
+    // FIPS 180-2 examples, the 56 byte one needs a second padding block
+    check(hex(crypto::sha256("")) == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", "empty input");
+    check(hex(crypto::sha256("abc")) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", "abc");
+    check(
+        hex(crypto::sha256("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"))
+            == "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1",
+        "448 bit message"
+    );
+    check(
+        hex(crypto::sha256(std::string(1000000, 'a'))) == "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0",
+        "a million a"
+    );
+
+    // lengths around the 64 byte block size
+    check(hex(crypto::sha256(std::string(63, 'a'))) == "7d3e74a05d7db15bce4ad9ec0658ea98e3f06eeecf16b4c6fff2da457ddc2f34", "63 bytes");
+    check(hex(crypto::sha256(std::string(64, 'a'))) == "ffe054fe7ae0cb6dc65c3af9b61d5209f439851db43d0ba5997337df154668eb", "64 bytes");
+    check(hex(crypto::sha256(std::string(65, 'a'))) == "635361c48bb9eab14198e76ea8ab7f1a41685d6ad62aa9146d301d4f17eb0ae0", "65 bytes");
+}
+
+static void testBase64Url() {
+    fmt::print("base64url\n");
+
+    // RFC 4648 section 10, without the padding
+    constexpr std::array<std::pair<std::string_view, std::string_view>, 7> vectors = {{
+        {"", ""}, {"f", "Zg"}, {"fo", "Zm8"}, {"foo", "Zm9v"}, {"foob", "Zm9vYg"}, {"fooba", "Zm9vYmE"}, {"foobar", "Zm9vYmFy"},
+    }};
+    for (auto [input, encoded] : vectors) {
+        check(crypto::base64Url(bytesOf(input)) == encoded, fmt::format("\"{}\" encodes to \"{}\"", input, encoded));
+    }
+
+    // the two characters that differ from plain base64 (+ and /)
+    constexpr std::array<uint8_t, 3> highBits = {0xfb, 0xff, 0xbf};
+    check(crypto::base64Url(highBits) == "-_-_", "url alphabet");
+
+    // RFC 7636 appendix B
+    auto challenge = crypto::base64Url(crypto::sha256("dBjftJeZ4CVP-mB92K27uhbUJU1p1r_wW1gFWFOEjXk"));
+    check(challenge == "E9Melhoa2OwvFrEMTJguCHaoeK1t8URWbuGJSstw-cM", "RFC 7636 S256 challenge");
+
+    auto token = crypto::randomToken(128);
+    check(token.size() == 128, "random token length");
+    check(
+        token.find_first_not_of("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~") == std::string::npos,
+        "random token uses unreserved characters"
+    );
+    check(token != crypto::randomToken(128), "random tokens differ");
+}
+
+static constexpr auto TOKEN_ENDPOINT = "http://127.0.0.1:21852/api/token";
+
+/// @brief Redirects with a foreign state are refused, the genuine one is exchanged with a verifier matching the challenge.
+static void testPkceExchange() {
+    fmt::print("pkce exchange\n");
+
+    auto auth = SpotifyAuth::get();
+    auth->authorize();
+    check(web::getOpenedLinks().size() == 1, "authorize opens the browser");
+    if (web::getOpenedLinks().empty()) return;
+
+    auto authorizeUrl = parseQuery(web::getOpenedLinks().back());
+    auto state = authorizeUrl["state"];
+    check(authorizeUrl["response_type"] == "code", "authorization code flow");
+    check(authorizeUrl["code_challenge_method"] == "S256", "S256 challenge");
+    check(authorizeUrl["redirect_uri"] == "http%3A%2F%2F127.0.0.1%3A21851%2F", "redirect uri is encoded");
+    check(state.size() >= 16, "authorize URL carries a state");
+
+    // a code pushed to the redirect port by anything else than the browser
+    check(!redirectToLocalAuthServer("forged", ""), "redirect without state is refused");
+    check(!redirectToLocalAuthServer("forged", state + "x"), "redirect with another state is refused");
+    runMainThread();
+    check(server().getReceivedCount() == 0, "refused codes are never exchanged");
+    check(Mod::get()->getSavedValue<std::string>("spotify-code", "") == "", "refused codes aren't saved");
+
+    check(redirectToLocalAuthServer("AQ+b/c=", state), "redirect with the state is accepted");
+    check(!redirectToLocalAuthServer("AQ+b/c=", state), "server stops after the accepted redirect");
+    runMainThread();
+
+    auto& pending = server().getPending();
+    check(pending.size() == 1, "one token request");
+    if (pending.size() != 1) return;
+
+    auto& request = pending[0].request;
+    auto body = parseQuery(request.body);
+    check(request.method == "POST" && request.url == TOKEN_ENDPOINT, "posted to the token endpoint");
+    check(
+        std::ranges::find(request.headers, std::pair<std::string, std::string>("Content-Type", "application/x-www-form-urlencoded"))
+            != request.headers.end(),
+        "form body"
+    );
+    check(body["grant_type"] == "authorization_code", "authorization_code grant");
+    check(body["code"] == "AQ%2Bb%2Fc%3D", "code is percent-encoded");
+    check(body["redirect_uri"] == authorizeUrl["redirect_uri"], "same redirect uri as the authorize URL");
+    check(body["client_id"] == authorizeUrl["client_id"], "same client as the authorize URL");
+    check(!body.contains("client_secret"), "no client secret");
+    check(
+        crypto::base64Url(crypto::sha256(body["code_verifier"])) == authorizeUrl["code_challenge"],
+        "verifier matches the challenge"
+    );
+
+    server().respond(0, web::WebResponse(200,
+        R"({"access_token":"access-1","token_type":"Bearer","expires_in":3600,"refresh_token":"refresh-1","scope":"user-read-playback-state"})"
+    ));
+    runMainThread();
+    check(Mod::get()->getSavedValue<std::string>("spotify-token", "") == "access-1", "access token saved");
+    check(Mod::get()->getSavedValue<std::string>("spotify-refresh", "") == "refresh-1", "refresh token saved");
+    check(Mod::get()->getSavedValue<bool>("spotify-pkce") && auth->hasPkceTokens(), "tokens marked as PKCE");
+    check(Mod::get()->getSavedValue<bool>("hasAuthorized"), "account linked");
+    check(auth->isTokenFresh(), "token fresh");
+
+    // a second authorization gets its own state, the old one is worthless
+    auth->authorize();
+    auto second = parseQuery(web::getOpenedLinks().back());
+    check(second["state"] != state, "new state per authorization");
+    check(second["code_challenge"] != authorizeUrl["code_challenge"], "new verifier per authorization");
+    check(!redirectToLocalAuthServer("stale", state), "state of the previous authorization is refused");
+    check(redirectToLocalAuthServer("second", second["state"]), "redirect of the second authorization is accepted");
+    runMainThread();
+
+    check(server().getPending().size() == 1, "second code exchanged");
+    if (server().getPending().empty()) return;
+    server().respond(0, web::WebResponse(400, R"({"error":"invalid_grant","error_description":"Invalid authorization code"})"));
+    runMainThread();
+    check(Mod::get()->getSavedValue<std::string>("spotify-token", "") == "access-1", "failed exchange keeps the tokens");
+}
+
+/// @brief Concurrent refreshes share one request and all get the new token, rotated refresh tokens are stored.
+static void testRefresh() {
+    fmt::print("refresh\n");
+
+    auto auth = SpotifyAuth::get();
+    std::vector<std::string> tokens;
+    auth->refresh([&](std::string token) { tokens.push_back(token); });
+    auth->refresh([&](std::string token) { tokens.push_back(token); });
+
+    auto& pending = server().getPending();
+    check(pending.size() == 1, "concurrent refreshes share a request");
+    if (pending.size() != 1) return;
+    auto body = parseQuery(pending[0].request.body);
+    check(pending[0].request.url == TOKEN_ENDPOINT, "refresh goes to the token endpoint");
+    check(body["grant_type"] == "refresh_token" && body["refresh_token"] == "refresh-1", "refresh_token grant");
+
+    server().respond(0, web::WebResponse(200, R"({"access_token":"access-2","expires_in":3600,"refresh_token":"refresh-2"})"));
+    runMainThread();
+    check(tokens == std::vector<std::string>{"access-2", "access-2"}, "every waiter gets the new token");
+    check(Mod::get()->getSavedValue<std::string>("spotify-refresh", "") == "refresh-2", "rotated refresh token saved");
+
+    // a request refused with the old token gets the new one without another refresh
+    tokens.clear();
+    auth->refresh([&](std::string token) { tokens.push_back(token); }, "access-1");
+    check(tokens == std::vector<std::string>{"access-2"} && server().getPending().empty(), "stale rejection answered from the store");
+
+    tokens.clear();
+    auth->refresh([&](std::string token) { tokens.push_back(token); }, "access-2");
+    if (server().getPending().size() != 1) {
+        check(false, "rejected token refreshes");
+        return;
+    }
+    server().respond(0, web::WebResponse(400, R"({"error":"invalid_grant","error_description":"Refresh token revoked"})"));
+    runMainThread();
+    check(tokens == std::vector<std::string>{""}, "revoked refresh calls back with no token");
+    check(!Mod::get()->getSavedValue<bool>("hasAuthorized"), "revoked refresh unlinks the account");
+}
+
+int main() {
+    Mod::get()->setSavedValue<std::string>("spotify-token-endpoint", TOKEN_ENDPOINT);
+
+    testSha256();
+    testBase64Url();
+    testPkceExchange();
+    testRefresh();
+
+    fmt::print("{}\n", s_failures ? fmt::format("{} checks failed", s_failures) : "all checks passed");
+    return s_failures ? 1 : 0;
+}
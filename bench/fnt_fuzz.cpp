@@ -0,0 +1,205 @@
+// Fuzz target and corpus replay for the BMFontConfiguration parser.
+//
+// Built as a libFuzzer target (fnt_fuzz) when compiling with clang, and always as fnt_replay, which runs the same
+// entry point over files and directories:
+//   fnt_replay [--iterations <n>] [--digests <out file>] [--expect <digest file>] [paths...]
+// Every input gets a digest of the parsed glyphs, kernings and metrics. Writing the digests with the current parser
+// and replaying with --expect after changing it checks that a new tokenizer produces exactly the same fonts.
+// corpus/fnt_digests.txt holds the digests of the default inputs (bundled fonts and corpus/fnt seeds).
+#include <managers/BMFontConfiguration.hpp>
+#include <Geode/utils/file.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+    struct ParsedFont : BMFontConfiguration {
+        using BMFontConfiguration::initWithContents;
+    };
+
+    #define FUZZ_CHECK(cond) do { if (!(cond)) { \
+        fmt::print(stderr, "fnt_fuzz: check failed: {} ({}:{})\n", #cond, __FILE__, __LINE__); \
+        std::abort(); \
+    } } while (0)
+
+    /// @brief Everything layout reads from a parsed font, in a stable order.
+    std::string describe(BMFontConfiguration const& font) {
+        std::string out = fmt::format(
+            "atlas={} height={} padding={},{},{},{} spacing={},{} range={} atlasScale={} textureScale={}\n",
+            font.getAtlasName(), font.getCommonHeight(),
+            font.getPadding().left, font.getPadding().top, font.getPadding().right, font.getPadding().bottom,
+            font.getSpacing().horizontal, font.getSpacing().vertical,
+            font.getDistanceRange(), font.getAtlasScale(), font.getTextureScale()
+        );
+
+        std::map<uint32_t, BMFontDef> defs(font.getFontDefDictionary().begin(), font.getFontDefDictionary().end());
+        for (auto& [id, def] : defs) {
+            out += fmt::format(
+                "char {} -> {} {},{} {}x{} {} {} {}\n", id, def.charID,
+                def.rect.origin.x, def.rect.origin.y, def.rect.size.width, def.rect.size.height,
+                def.xOffset, def.yOffset, def.xAdvance
+            );
+        }
+
+        std::map<uint64_t, float> kernings;
+        for (auto& [pair, amount] : font.getKerningDictionary()) {
+            kernings.emplace(pair.toInt(), amount);
+        }
+        for (auto& [pair, amount] : kernings) {
+            out += fmt::format("kerning {} {} {}\n", pair >> 32, pair & 0xFFFFFFFF, amount);
+        }
+        return out;
+    }
+
+    uint64_t hash(std::string_view data) {
+        // FNV-1a
+        uint64_t value = 0xcbf29ce484222325;
+        for (char c : data) {
+            value = (value ^ static_cast<unsigned char>(c)) * 0x100000001b3;
+        }
+        return value;
+    }
+
+    /// @brief Parse the input and check the invariants layout relies on. Returns the digest, 0 if parsing failed.
+    uint64_t parseAndCheck(std::string const& contents) {
+        ParsedFont font;
+        if (!font.initWithContents(contents, GEODE_MOD_ID "/fuzz.fnt")) {
+            return 0;
+        }
+
+        FUZZ_CHECK(!font.getAtlasName().empty());
+        FUZZ_CHECK(std::isfinite(font.getCommonHeight()));
+        FUZZ_CHECK(std::isfinite(font.getTextureScale()) && font.getTextureScale() > 0.f);
+        FUZZ_CHECK(std::isfinite(font.getEffectReach()) && font.getEffectReach() >= 0.f);
+
+        auto& defs = font.getFontDefDictionary();
+        for (auto& [id, def] : defs) {
+            FUZZ_CHECK(std::isfinite(def.xOffset) && std::isfinite(def.yOffset) && std::isfinite(def.xAdvance));
+            // aliases point at real glyphs
+            FUZZ_CHECK(def.charID == id || defs.contains(def.charID));
+        }
+        for (auto& [pair, amount] : font.getKerningDictionary()) {
+            FUZZ_CHECK(std::isfinite(amount));
+        }
+
+        // 0 is reserved for failed parses
+        return hash(describe(font)) | 1;
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    parseAndCheck(std::string(reinterpret_cast<const char*>(data), size));
+    return 0;
+}
+
+#ifndef FNT_FUZZ_LIBFUZZER
+
+int main(int argc, char** argv) {
+    size_t iterations = 20;
+    std::filesystem::path digestsOut;
+    std::filesystem::path digestsIn;
+    std::vector<std::filesystem::path> paths;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--iterations" && i + 1 < argc) {
+            iterations = std::max<size_t>(std::strtoul(argv[++i], nullptr, 10), 1);
+        } else if (arg == "--digests" && i + 1 < argc) {
+            digestsOut = argv[++i];
+        } else if (arg == "--expect" && i + 1 < argc) {
+            digestsIn = argv[++i];
+        } else {
+            paths.emplace_back(arg);
+        }
+    }
+    if (paths.empty()) {
+        paths = {BENCH_FONT_DIR, BENCH_FNT_CORPUS};
+    }
+
+    std::vector<std::filesystem::path> files;
+    for (auto& path : paths) {
+        if (std::filesystem::is_directory(path)) {
+            for (auto& entry : std::filesystem::recursive_directory_iterator(path)) {
+                if (entry.is_regular_file() && entry.path().extension() != ".png") {
+                    files.push_back(entry.path());
+                }
+            }
+        } else {
+            files.push_back(path);
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    // "<digest> <file name>" per line
+    std::map<std::string, std::string> expected;
+    if (!digestsIn.empty()) {
+        auto contents = geode::utils::file::readString(digestsIn).unwrapOrDefault();
+        std::string_view rest = contents;
+        while (!rest.empty()) {
+            auto end = std::min(rest.find('\n'), rest.size());
+            auto line = rest.substr(0, end);
+            rest.remove_prefix(std::min(end + 1, rest.size()));
+            if (auto space = line.find(' '); space != std::string_view::npos) {
+                expected.emplace(line.substr(space + 1), line.substr(0, space));
+            }
+        }
+    }
+
+    std::string digests;
+    size_t totalBytes = 0;
+    size_t mismatches = 0;
+    double totalSeconds = 0.0;
+    for (auto& file : files) {
+        auto contents = geode::utils::file::readString(file).unwrapOrDefault();
+        auto name = file.filename().string();
+
+        uint64_t digest = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            digest = parseAndCheck(contents);
+        }
+        auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        totalSeconds += seconds;
+        totalBytes += contents.size() * iterations;
+
+        auto digestStr = digest ? fmt::format("{:016x}", digest) : std::string("failed");
+        digests += fmt::format("{} {}\n", digestStr, name);
+
+        std::string_view status = "";
+        if (!digestsIn.empty()) {
+            auto it = expected.find(name);
+            if (it == expected.end()) {
+                status = "new";
+            } else if (it->second != digestStr) {
+                status = "MISMATCH";
+                ++mismatches;
+            }
+        }
+
+        fmt::print(
+            "{:<32} {:>10} {:>10.1f} MB/s  {} {}\n", name, contents.size(),
+            contents.size() * iterations / std::max(seconds, 1e-9) / (1024.0 * 1024.0), digestStr, status
+        );
+    }
+
+    fmt::print(
+        "{} inputs, {:.1f} MB/s overall, {} mismatches\n", files.size(),
+        totalBytes / std::max(totalSeconds, 1e-9) / (1024.0 * 1024.0), mismatches
+    );
+
+    if (!digestsOut.empty()) {
+        if (auto res = geode::utils::file::writeString(digestsOut, digests); res.isErr()) {
+            fmt::print(stderr, "Failed to write '{}': {}\n", digestsOut.string(), res.unwrapErr());
+            return 1;
+        }
+    }
+    return mismatches ? 1 : 0;
+}
+
+#endif
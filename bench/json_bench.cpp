@@ -0,0 +1,164 @@
+// Benchmark of the Spotify player response extraction on recorded payloads.
+// Usage: json_bench [--iterations <n>] [payload files or directories...]
+// Compares SpotifyPlayerState::parse (JsonExtractor, no tree) with parsing the whole document into a DOM and reading
+// the same fields (jsoncpp, when it was found at configure time), and checks that both read the same values.
+#include <managers/SpotifyPlayerState.hpp>
+#include <Geode/utils/file.hpp>
+#include <fmt/format.h>
+#include "alloc_counter.hpp"
+
+#ifdef BENCH_HAVE_JSONCPP
+#include <json/json.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// === Helpers ===
+
+using Clock = std::chrono::steady_clock;
+
+struct Measurement {
+    double seconds = 0.0;
+    size_t allocations = 0;
+};
+
+static Measurement measure(size_t iterations, std::function<void()> const& body) {
+    auto allocations = s_allocations.load();
+    auto start = Clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        body();
+    }
+    auto end = Clock::now();
+    return {std::chrono::duration<double>(end - start).count(), s_allocations.load() - allocations};
+}
+
+static void printResult(std::string_view name, Measurement const& result, size_t bytes, size_t iterations) {
+    fmt::print(
+        "  {:<12} {:>10.1f} {:>12.0f} {:>14.1f}\n", name,
+        bytes * iterations / result.seconds / (1024.0 * 1024.0),
+        result.seconds * 1e9 / iterations,
+        static_cast<double>(result.allocations) / iterations
+    );
+}
+
+#ifdef BENCH_HAVE_JSONCPP
+/// @brief The same fields, read from a full document tree.
+static std::optional<SpotifyPlayerState> parseDom(std::string const& json) {
+    static std::unique_ptr<Json::CharReader> reader(Json::CharReaderBuilder().newCharReader());
+    Json::Value root;
+    if (!reader->parse(json.data(), json.data() + json.size(), &root, nullptr) || !root.isObject()) {
+        return std::nullopt;
+    }
+
+    auto string = [](Json::Value const& value) -> std::optional<std::string> {
+        if (!value.isString()) return std::nullopt;
+        return value.asString();
+    };
+    auto integer = [](Json::Value const& value) -> std::optional<int64_t> {
+        if (!value.isIntegral()) return std::nullopt;
+        return value.asInt64();
+    };
+
+    SpotifyPlayerState state;
+    if (root["is_playing"].isBool()) state.isPlaying = root["is_playing"].asBool();
+    state.progressMs = integer(root["progress_ms"]);
+    state.playingType = string(root["currently_playing_type"]);
+    state.device = string(root["device"]["name"]);
+
+    auto& item = root["item"];
+    if (item.isObject()) {
+        state.trackID = string(item["id"]);
+        state.title = string(item["name"]);
+        state.durationMs = integer(item["duration_ms"]);
+        if (item["artists"].isArray() && !item["artists"].empty()) {
+            state.artist = string(item["artists"][0]["name"]);
+        }
+        auto& images = item["album"]["images"];
+        if (images.isArray() && !images.empty()) {
+            state.artUrl = string(images[0]["url"]);
+        }
+    }
+    return state;
+}
+
+static bool sameFields(SpotifyPlayerState const& a, SpotifyPlayerState const& b) {
+    return a.isPlaying == b.isPlaying && a.progressMs == b.progressMs && a.playingType == b.playingType
+        && a.device == b.device && a.trackID == b.trackID && a.title == b.title && a.artist == b.artist
+        && a.artUrl == b.artUrl && a.durationMs == b.durationMs;
+}
+#endif
+
+int main(int argc, char** argv) {
+    size_t iterations = 20000;
+    std::vector<std::filesystem::path> paths;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--iterations" && i + 1 < argc) {
+            iterations = std::max<size_t>(std::strtoul(argv[++i], nullptr, 10), 1);
+        } else {
+            paths.emplace_back(arg);
+        }
+    }
+    if (paths.empty()) {
+        paths.emplace_back(BENCH_SPOTIFY_CORPUS);
+    }
+
+    std::vector<std::filesystem::path> files;
+    for (auto& path : paths) {
+        if (std::filesystem::is_directory(path)) {
+            for (auto& entry : std::filesystem::directory_iterator(path)) {
+                if (entry.path().extension() == ".json") {
+                    files.push_back(entry.path());
+                }
+            }
+        } else {
+            files.push_back(path);
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    int failures = 0;
+    for (auto& file : files) {
+        auto contents = geode::utils::file::readString(file).unwrapOrDefault();
+        fmt::print("{} ({} bytes)\n", file.filename().string(), contents.size());
+
+        auto parsed = SpotifyPlayerState::parse(contents);
+        if (parsed.isErr()) {
+            fmt::print("  failed to parse: {}\n", parsed.unwrapErr());
+            ++failures;
+            continue;
+        }
+        auto state = parsed.unwrap();
+        fmt::print(
+            "  {} / {} / {} ({}/{} ms, {})\n", state.title.value_or("-"), state.artist.value_or("-"),
+            state.playingType.value_or("-"), state.progressMs.value_or(0), state.durationMs.value_or(0),
+            state.isPlaying.value_or(false) ? "playing" : "paused"
+        );
+
+        fmt::print("  {:<12} {:>10} {:>12} {:>14}\n", "parser", "MB/s", "ns/payload", "allocs/payload");
+        printResult("extractor", measure(iterations, [&] {
+            auto res = SpotifyPlayerState::parse(contents);
+            (void)res;
+        }), contents.size(), iterations);
+
+#ifdef BENCH_HAVE_JSONCPP
+        auto dom = parseDom(contents);
+        if (!dom || !sameFields(*dom, state)) {
+            fmt::print("  MISMATCH between the extractor and the DOM parse\n");
+            ++failures;
+        }
+        printResult("dom", measure(iterations, [&] {
+            auto res = parseDom(contents);
+            (void)res;
+        }), contents.size(), iterations);
+#endif
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,347 @@
+// Headless benchmarks for BMFontConfiguration parsing, Label layout and wrapped line breaking.
+// Usage: font_bench [--fonts <dir>] [--corpus <file>] [--iterations <n>] [--scale <content scale>]
+#include <managers/AdvancedLabelManager.hpp>
+#include <managers/BMFontConfiguration.hpp>
+#include <Geode/utils/file.hpp>
+#include <Geode/utils/string.hpp>
+#include "alloc_counter.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+// === Helpers ===
+
+using Clock = std::chrono::steady_clock;
+
+struct Measurement {
+    double seconds = 0.0;
+    size_t allocations = 0;
+};
+
+static Measurement measure(size_t iterations, std::function<void()> const& body) {
+    auto allocations = s_allocations.load();
+    auto start = Clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        body();
+    }
+    cocos2d::drainAutoreleasePool();
+    auto end = Clock::now();
+    return {std::chrono::duration<double>(end - start).count(), s_allocations.load() - allocations};
+}
+
+/// @brief Exposes the parser entry point, so parsing can be timed without the file read and the config cache.
+struct ParsedFont : BMFontConfiguration {
+    using BMFontConfiguration::initWithContents;
+};
+
+/// @brief Exposes the wrapped line splitting, so it can be compared with the space-only splitter it replaced.
+struct LineBreaker : Label {
+    using Label::splitWords;
+    using Label::WordSlice;
+};
+
+struct Options {
+    std::filesystem::path fontDir = BENCH_FONT_DIR;
+    std::filesystem::path corpus = BENCH_CORPUS;
+    size_t iterations = 200;
+    float scale = 1.f;
+};
+
+static std::vector<std::string> readCorpus(std::filesystem::path const& path) {
+    auto contents = geode::utils::file::readString(path).unwrapOrDefault();
+    std::vector<std::string> lines;
+    std::string_view rest = contents;
+    while (!rest.empty()) {
+        auto end = std::min(rest.find('\n'), rest.size());
+        auto line = rest.substr(0, end);
+        rest.remove_prefix(std::min(end + 1, rest.size()));
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        if (!line.empty() && !line.starts_with('#')) {
+            lines.emplace_back(line);
+        }
+    }
+    return lines;
+}
+
+static size_t countCodepoints(std::string_view text) {
+    return std::count_if(text.begin(), text.end(), [](char c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; });
+}
+
+// === Benchmarks ===
+
+static void benchParse(Options const& options) {
+    std::vector<std::filesystem::path> files;
+    for (auto& entry : std::filesystem::directory_iterator(options.fontDir)) {
+        if (entry.path().extension() == ".fnt") {
+            files.push_back(entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    fmt::print("Parsing ({} fonts)\n", files.size());
+    fmt::print("  {:<28} {:>10} {:>8} {:>10} {:>12} {:>14}\n", "font", "size", "glyphs", "MB/s", "ns/glyph", "allocs/parse");
+    for (auto& file : files) {
+        auto contents = geode::utils::file::readString(file).unwrapOrDefault();
+        auto fntFile = file.string();
+
+        size_t glyphs = 0;
+        {
+            ParsedFont font;
+            if (!font.initWithContents(contents, fntFile)) {
+                fmt::print("  {:<28} failed to parse\n", file.filename().string());
+                continue;
+            }
+            glyphs = font.getFontDefDictionary().size();
+        }
+
+        // roughly the same amount of text for every font, so small files don't finish in microseconds
+        auto iterations = std::clamp<size_t>(options.iterations * 64 * 1024 / std::max<size_t>(contents.size(), 1), 3, options.iterations * 16);
+        auto result = measure(iterations, [&] {
+            ParsedFont font;
+            font.initWithContents(contents, fntFile);
+        });
+
+        fmt::print(
+            "  {:<28} {:>10} {:>8} {:>10.1f} {:>12.1f} {:>14.0f}\n",
+            file.filename().string(), memory::formatBytes(contents.size()), glyphs,
+            contents.size() * iterations / result.seconds / (1024.0 * 1024.0),
+            result.seconds * 1e9 / (static_cast<double>(glyphs) * iterations),
+            static_cast<double>(result.allocations) / iterations
+        );
+    }
+}
+
+static void printLayout(std::string_view name, Measurement const& result, size_t layouts, size_t glyphs) {
+    fmt::print(
+        "  {:<28} {:>12.1f} {:>12.0f} {:>16.1f}\n",
+        name,
+        result.seconds * 1e9 / static_cast<double>(glyphs),
+        result.seconds * 1e9 / static_cast<double>(layouts),
+        static_cast<double>(result.allocations) / layouts
+    );
+}
+
+static void benchLayout(Options const& options) {
+    auto titles = readCorpus(options.corpus);
+    if (titles.empty()) {
+        fmt::print("No titles in corpus '{}'\n", options.corpus.string());
+        return;
+    }
+
+    size_t corpusGlyphs = 0;
+    for (auto& title : titles) {
+        corpusGlyphs += countCodepoints(title);
+    }
+
+    auto createLabel = [](bool wrapped) {
+        auto label = wrapped
+            ? Label::createWrapped("", GEODE_MOD_ID "/font_default.fnt", 200.f)
+            : Label::create("", GEODE_MOD_ID "/font_default.fnt");
+        label->addAllFonts();
+        // owned by the benchmark instead of a parent node
+        label->retain();
+        return label;
+    };
+
+    auto iterations = std::max<size_t>(options.iterations / 10, 1);
+    fmt::print("\nLayout ({} titles, {} glyphs, {} passes)\n", titles.size(), corpusGlyphs, iterations);
+    fmt::print("  {:<28} {:>12} {:>12} {:>16}\n", "case", "ns/glyph", "ns/layout", "allocs/layout");
+
+    for (bool wrapped : {false, true}) {
+        auto label = createLabel(wrapped);
+        auto pass = [&] {
+            for (auto& title : titles) {
+                label->setString(title);
+            }
+        };
+
+        // the first pass loads the fonts and creates the glyph sprites
+        pass();
+        cocos2d::drainAutoreleasePool();
+        auto result = measure(iterations, pass);
+        printLayout(wrapped ? "setString (wrapped)" : "setString", result, titles.size() * iterations, corpusGlyphs * iterations);
+        label->release();
+    }
+
+    // a list of rows updated at once, every row getting the title of the next one
+    constexpr size_t rowCount = 16;
+    std::vector<Label*> rows;
+    for (size_t i = 0; i < rowCount; ++i) {
+        rows.push_back(createLabel(false));
+    }
+
+    size_t offset = 0;
+    size_t batchGlyphs = 0;
+    auto batch = [&] {
+        std::vector<std::pair<Label*, std::string_view>> labels;
+        for (size_t i = 0; i < rowCount; ++i) {
+            auto& title = titles[(offset + i) % titles.size()];
+            labels.emplace_back(rows[i], title);
+            batchGlyphs += countCodepoints(title);
+        }
+        Label::setStrings(labels);
+        ++offset;
+    };
+
+    batch();
+    cocos2d::drainAutoreleasePool();
+    batchGlyphs = 0;
+    auto batches = iterations * titles.size() / rowCount + 1;
+    auto result = measure(batches, batch);
+    printLayout(fmt::format("setStrings ({} rows)", rowCount), result, batches * rowCount, batchGlyphs);
+
+    for (auto row : rows) {
+        row->release();
+    }
+}
+
+/// @brief The word split of layoutTextWrapped before UAX #14 break opportunities: spaces, newlines
+/// and every breakWords characters only. Kept here as the baseline for Latin text.
+static void splitWordsAtSpaces(std::u32string_view text, int breakWords, std::vector<std::vector<std::u32string_view>>& outLines) {
+    auto stringLen = text.size();
+    size_t wordStart = 0;
+    std::vector<std::u32string_view> words;
+    for (size_t i = 0; i < stringLen; ++i) {
+        if (text[i] == ' ') {
+            words.push_back(text.substr(wordStart, i - wordStart));
+            wordStart = i + 1;
+            continue;
+        }
+
+        if (text[i] == '\n') {
+            words.push_back(text.substr(wordStart, i - wordStart));
+            wordStart = i + 1;
+            outLines.push_back(std::move(words));
+            words.clear();
+        } else if (i == stringLen - 1) {
+            words.push_back(text.substr(wordStart, i - wordStart + 1));
+            outLines.push_back(std::move(words));
+            words.clear();
+        } else if (breakWords > 0 && i - wordStart >= static_cast<size_t>(breakWords)) {
+            words.push_back(text.substr(wordStart, i - wordStart));
+            wordStart = i;
+        }
+    }
+    if (!words.empty()) {
+        outLines.push_back(std::move(words));
+    }
+}
+
+static void benchLineBreaking(Options const& options) {
+    // Latin titles only (up to Latin Extended-B), where both splitters find the same words
+    std::vector<std::u32string> titles;
+    size_t glyphs = 0;
+    for (auto& title : readCorpus(options.corpus)) {
+        auto text = geode::utils::string::utf8ToUtf32(title).unwrapOrDefault();
+        if (text.empty() || std::any_of(text.begin(), text.end(), [](char32_t c) { return c >= 0x250; })) {
+            continue;
+        }
+        glyphs += text.size();
+        titles.push_back(std::move(text));
+    }
+    if (titles.empty()) {
+        return;
+    }
+
+    auto iterations = options.iterations * 10;
+    fmt::print("\nLine breaking ({} Latin titles, {} glyphs, {} passes)\n", titles.size(), glyphs, iterations);
+    fmt::print("  {:<28} {:>12} {:>12} {:>16}\n", "case", "ns/glyph", "ns/title", "allocs/title");
+
+    // both splits take well under a microsecond per title, so they take turns and the fastest round of each counts
+    constexpr int ROUNDS = 7;
+    size_t words = 0;
+    Measurement spaces, uax14;
+    for (int round = 0; round < ROUNDS; ++round) {
+        auto spacesRound = measure(iterations, [&] {
+            for (auto& title : titles) {
+                std::vector<std::vector<std::u32string_view>> lines;
+                splitWordsAtSpaces(title, -1, lines);
+                words += lines.size();
+            }
+        });
+        auto uax14Round = measure(iterations, [&] {
+            for (auto& title : titles) {
+                std::vector<std::vector<LineBreaker::WordSlice>> lines;
+                LineBreaker::splitWords(title, -1, lines);
+                words += lines.size();
+            }
+        });
+        if (round == 0 || spacesRound.seconds < spaces.seconds) spaces = spacesRound;
+        if (round == 0 || uax14Round.seconds < uax14.seconds) uax14 = uax14Round;
+    }
+    printLayout("spaces only (before)", spaces, titles.size() * iterations, glyphs * iterations);
+    printLayout("UAX #14 (splitWords)", uax14, titles.size() * iterations, glyphs * iterations);
+    fmt::print("  {:<28} {:>12.2f}x\n", "ratio", uax14.seconds / spaces.seconds);
+
+    // the share of wrapped layout the split takes
+    auto label = Label::createWrapped("", GEODE_MOD_ID "/font_default.fnt", 200.f);
+    label->addAllFonts();
+    label->retain();
+    std::vector<std::string> utf8Titles;
+    for (auto& title : titles) {
+        utf8Titles.push_back(geode::utils::string::utf32ToUtf8(title).unwrapOrDefault());
+    }
+    auto layout = [&] {
+        for (auto& title : utf8Titles) {
+            label->setString(title);
+        }
+    };
+    layout();
+    cocos2d::drainAutoreleasePool();
+    auto layoutIterations = std::max<size_t>(options.iterations / 10, 1);
+    auto wrapped = measure(layoutIterations, layout);
+    printLayout("setString (wrapped)", wrapped, titles.size() * layoutIterations, glyphs * layoutIterations);
+    label->release();
+
+    // keeps the splits from being optimized away
+    if (words == 0) {
+        fmt::print("  no words\n");
+    }
+}
+
+static void printMemory() {
+    std::vector<memory::Usage> fonts;
+    BMFontConfiguration::collectMemoryStats(fonts);
+
+    fmt::print("\nLoaded fonts\n");
+    for (auto& usage : fonts) {
+        fmt::print("  {:<28} {:>10} {:>8} glyphs\n", std::filesystem::path(usage.name).filename().string(), memory::formatBytes(usage.bytes), usage.count);
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string_view arg = argv[i];
+        if (arg == "--fonts") {
+            options.fontDir = argv[i + 1];
+        } else if (arg == "--corpus") {
+            options.corpus = argv[i + 1];
+        } else if (arg == "--iterations") {
+            options.iterations = std::max<size_t>(std::strtoul(argv[i + 1], nullptr, 10), 1);
+        } else if (arg == "--scale") {
+            options.scale = std::strtof(argv[i + 1], nullptr);
+        } else {
+            fmt::print(stderr, "Unknown option '{}'\n", arg);
+            return 1;
+        }
+    }
+
+    cocos2d::CCDirector::get()->m_fContentScaleFactor = options.scale;
+    cocos2d::CCFileUtils::get()->addSearchPath(options.fontDir.string());
+    // every font stays loaded, eviction is not what is measured here
+    BMFontConfiguration::setMemoryBudget(SIZE_MAX);
+
+    benchParse(options);
+    benchLayout(options);
+    benchLineBreaking(options);
+    printMemory();
+    return 0;
+}
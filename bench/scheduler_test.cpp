@@ -0,0 +1,253 @@
+// RequestScheduler against a stand-in network (web::MockServer) that answers requests in any order, or not at all.
+// Usage: scheduler_test [--rounds <n>] [--seed <n>]
+// Checks that no command is dropped under constant metadata polling, that queued requests start by priority,
+// and that cancelled requests never call back. Exits with 1 if a check fails.
+#include <managers/RequestScheduler.hpp>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static size_t s_failures = 0;
+
+static void check(bool condition, std::string_view what) {
+    if (!condition) {
+        fmt::print("  FAIL {}\n", what);
+        ++s_failures;
+    }
+}
+
+static web::MockServer& server() {
+    return web::MockServer::get();
+}
+
+static void runMainThread() {
+    Loader::get()->runMainThreadQueue();
+}
+
+/// @brief Answer every pending request in order, until nothing is left in flight or queued.
+static void drain() {
+    while (!server().getPending().empty()) {
+        server().respond(0, web::WebResponse(200));
+        runMainThread();
+    }
+}
+
+/// @brief Cancel the requests the scheduler still holds, so their callbacks can't outlive the test.
+/// @return how many there were (they would never have been sent)
+static size_t cancelRemaining(std::vector<RequestHandle>& handles) {
+    size_t remaining = 0;
+    for (auto& handle : handles) {
+        if (!handle.isDone()) {
+            ++remaining;
+            handle.cancel();
+        }
+    }
+    return remaining;
+}
+
+static RequestHandle enqueue(RequestPriority priority, std::string body, std::function<void(web::WebResponse)> callback) {
+    web::WebRequest request;
+    request.bodyString(body);
+    return RequestScheduler::get().enqueue({
+        .method = priority == RequestPriority::MetadataPoll ? RequestMethod::Get : RequestMethod::Put,
+        .url = "https://api.spotify.com/v1/me/player",
+        .request = std::move(request),
+        .priority = priority,
+        .callback = std::move(callback),
+    });
+}
+
+/// @brief Overlay polls every frame while commands arrive, and the server answers in random order with random latency.
+/// Every command has to reach the server exactly once and call back exactly once.
+static void testNoCommandDropped(size_t rounds, uint32_t seed) {
+    fmt::print("no command dropped ({} rounds, seed {})\n", rounds, seed);
+
+    std::mt19937 random(seed);
+    std::vector<int> callbacks;    // callbacks per command
+    std::vector<int> received;     // requests per command seen by the server
+    std::vector<RequestHandle> handles;
+    size_t polls = 0, pollCallbacks = 0;
+    size_t maxInFlight = 0, maxPollsInFlight = 0;
+
+    auto countPending = [&] {
+        auto& pending = server().getPending();
+        size_t pendingPolls = 0;
+        for (auto& exchange : pending) {
+            if (exchange.request.method == "GET") ++pendingPolls;
+        }
+        maxInFlight = std::max(maxInFlight, pending.size());
+        maxPollsInFlight = std::max(maxPollsInFlight, pendingPolls);
+    };
+
+    auto firstReceived = server().getReceivedCount();
+    for (size_t round = 0; round < rounds; ++round) {
+        // a poll per frame, its callback only counts
+        ++polls;
+        handles.push_back(enqueue(RequestPriority::MetadataPoll, "poll", [&](web::WebResponse) { ++pollCallbacks; }));
+
+        // now and then a button press or an automatic pause
+        if (random() % 4 == 0) {
+            auto index = callbacks.size();
+            callbacks.push_back(0);
+            received.push_back(0);
+            auto priority = random() % 2 ? RequestPriority::UserControl : RequestPriority::AutoPause;
+            handles.push_back(enqueue(priority, fmt::format("command {}", index), [&, index](web::WebResponse response) {
+                ++callbacks[index];
+                check(response.ok(), "command response is passed through");
+            }));
+        }
+        countPending();
+
+        // the server answers some of the requests in flight, in any order
+        auto answers = random() % 3;
+        for (size_t i = 0; i < answers && !server().getPending().empty(); ++i) {
+            auto& pending = server().getPending();
+            auto index = random() % pending.size();
+            auto& body = pending[index].request.body;
+            if (body.starts_with("command ")) {
+                ++received[std::stoul(body.substr(8))];
+            }
+            server().respond(index, web::WebResponse(200));
+        }
+        runMainThread();
+        countPending();
+    }
+
+    // let everything still queued through
+    while (!server().getPending().empty()) {
+        auto& body = server().getPending().front().request.body;
+        if (body.starts_with("command ")) {
+            ++received[std::stoul(body.substr(8))];
+        }
+        server().respond(0, web::WebResponse(200));
+        runMainThread();
+    }
+
+    auto stuck = cancelRemaining(handles);
+    size_t dropped = 0, duplicated = 0;
+    for (size_t i = 0; i < callbacks.size(); ++i) {
+        if (callbacks[i] == 0 || received[i] == 0) ++dropped;
+        if (callbacks[i] > 1 || received[i] > 1) ++duplicated;
+    }
+    auto sent = server().getReceivedCount() - firstReceived;
+
+    fmt::print(
+        "  {} commands, {} polls enqueued, {} requests sent, {} in flight at most\n",
+        callbacks.size(), polls, sent, maxInFlight
+    );
+    check(stuck == 0, fmt::format("{} requests never sent", stuck));
+    check(dropped == 0, fmt::format("{} commands dropped", dropped));
+    check(duplicated == 0, fmt::format("{} commands sent or called back twice", duplicated));
+    check(pollCallbacks == polls, fmt::format("{} of {} polls called back", pollCallbacks, polls));
+    check(maxInFlight <= 4, "at most 4 requests in flight");
+    check(maxPollsInFlight <= 1, "at most one poll in flight");
+}
+
+/// @brief With every slot taken, queued requests start by priority, then in arrival order.
+static void testPriorityOrder() {
+    fmt::print("priority order\n");
+
+    std::vector<std::string> completed;
+    auto record = [&](std::string name) {
+        return [&completed, name](web::WebResponse) { completed.push_back(name); };
+    };
+
+    // fill all slots with commands that stay unanswered
+    std::vector<RequestHandle> handles;
+    for (int i = 0; i < 4; ++i) {
+        handles.push_back(enqueue(RequestPriority::AutoPause, "blocker", record("blocker")));
+    }
+    check(server().getPending().size() == 4, "4 requests in flight");
+
+    handles.push_back(enqueue(RequestPriority::MetadataPoll, "poll", record("poll")));
+    handles.push_back(enqueue(RequestPriority::AutoPause, "pause", record("pause")));
+    handles.push_back(enqueue(RequestPriority::UserControl, "play", record("play")));
+    handles.push_back(enqueue(RequestPriority::UserControl, "next", record("next")));
+    check(server().getPending().size() == 4, "queued requests wait for a slot");
+
+    // free one slot at a time and see which queued request takes it
+    std::vector<std::string> sentOrder;
+    while (!server().getPending().empty()) {
+        auto received = server().getReceivedCount();
+        server().respond(0, web::WebResponse(200));
+        runMainThread();
+        if (server().getReceivedCount() > received) {
+            sentOrder.push_back(server().getPending().back().request.body);
+        }
+    }
+
+    auto order = fmt::format("{}", fmt::join(sentOrder, ","));
+    check(order == "play,next,pause,poll", fmt::format("sent in priority order (got {})", order));
+    check(cancelRemaining(handles) == 0, "every queued request was sent");
+    check(completed.size() == 8, "every request called back");
+}
+
+/// @brief Cancelled requests never call back, in the queue, in flight, or after their response arrived.
+static void testCancel() {
+    fmt::print("cancel\n");
+
+    int calls = 0;
+    auto count = [&](web::WebResponse) { ++calls; };
+
+    // in flight: aborted, the slot is free again
+    auto inFlight = enqueue(RequestPriority::UserControl, "in flight", count);
+    check(!inFlight.isDone(), "request in flight is not done");
+    inFlight.cancel();
+    check(inFlight.isDone(), "cancelled request is done");
+    check(server().getPending().empty(), "cancelled request is aborted");
+
+    // queued: never sent
+    std::vector<RequestHandle> handles;
+    for (int i = 0; i < 4; ++i) {
+        handles.push_back(enqueue(RequestPriority::UserControl, "blocker", count));
+    }
+    auto received = server().getReceivedCount();
+    auto queued = enqueue(RequestPriority::UserControl, "queued", count);
+    check(!queued.isDone(), "queued request is not done");
+    queued.cancel();
+    check(queued.isDone(), "cancelled queued request is done");
+    drain();
+    check(server().getReceivedCount() == received, "cancelled queued request is never sent");
+    check(cancelRemaining(handles) == 0, "blockers are done");
+    check(calls == 4, "only the blockers called back");
+
+    // answered, but cancelled before the main thread got to the response
+    calls = 0;
+    auto late = enqueue(RequestPriority::UserControl, "late", count);
+    check(server().getPending().size() == 1, "request is sent right away");
+    if (!server().getPending().empty()) {
+        server().respond(0, web::WebResponse(200));
+    }
+    late.cancel();
+    runMainThread();
+    check(calls == 0, "request cancelled after its response arrived doesn't call back");
+    check(late.isDone(), "late cancelled request is done");
+}
+
+int main(int argc, char** argv) {
+    size_t rounds = 2000;
+    uint32_t seed = 1;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string_view arg = argv[i];
+        if (arg == "--rounds") {
+            rounds = std::max<size_t>(std::strtoul(argv[i + 1], nullptr, 10), 1);
+        } else if (arg == "--seed") {
+            seed = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+        } else {
+            fmt::print("Unknown option {}\n", arg);
+            return 1;
+        }
+    }
+
+    testNoCommandDropped(rounds, seed);
+    testPriorityOrder();
+    testCancel();
+
+    fmt::print("{}\n", s_failures ? fmt::format("{} checks failed", s_failures) : "all checks passed");
+    return s_failures ? 1 : 0;
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include <cocos2d.h>
+#include <Geode/Result.hpp>
+#include <Geode/loader/Loader.hpp>
+#include <Geode/loader/Log.hpp>
+#include <Geode/loader/Mod.hpp>
+#include <Geode/utils/cocos.hpp>
+#include <Geode/utils/file.hpp>
+#include <Geode/utils/general.hpp>
+#include <Geode/utils/string.hpp>
+
+namespace geode::prelude {
+    using namespace ::geode;
+    using namespace ::geode::utils;
+    using namespace ::cocos2d;
+}
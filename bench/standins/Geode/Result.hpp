@@ -0,0 +1,62 @@
+#pragma once
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace geode {
+    template <class T = void, class E = std::string>
+    class Result {
+    public:
+        Result(std::optional<T> value, E error) : m_value(std::move(value)), m_error(std::move(error)) {}
+        bool isOk() const { return m_value.has_value(); }
+        bool isErr() const { return !m_value.has_value(); }
+        explicit operator bool() const { return isOk(); }
+        T unwrap() { return std::move(*m_value); }
+        T unwrapOr(T other) { return m_value ? std::move(*m_value) : std::move(other); }
+        T unwrapOrDefault() { return m_value ? std::move(*m_value) : T{}; }
+        E unwrapErr() { return m_error; }
+
+    private:
+        std::optional<T> m_value;
+        E m_error;
+    };
+
+    template <class E>
+    class Result<void, E> {
+    public:
+        Result(bool ok, E error) : m_ok(ok), m_error(std::move(error)) {}
+        bool isOk() const { return m_ok; }
+        bool isErr() const { return !m_ok; }
+        explicit operator bool() const { return m_ok; }
+        E unwrapErr() { return m_error; }
+
+    private:
+        bool m_ok;
+        E m_error;
+    };
+
+    struct OkVoid {
+        template <class E>
+        operator Result<void, E>() const { return {true, {}}; }
+    };
+
+    template <class T>
+    struct OkValue {
+        T value;
+        template <class U, class E>
+        operator Result<U, E>() && { return {std::optional<U>(std::move(value)), {}}; }
+    };
+
+    struct ErrValue {
+        std::string error;
+        template <class T, class E>
+        operator Result<T, E>() const { return {std::nullopt, error}; }
+        template <class E>
+        operator Result<void, E>() const { return {false, error}; }
+    };
+
+    inline OkVoid Ok() { return {}; }
+    template <class T>
+    OkValue<std::decay_t<T>> Ok(T&& value) { return {std::forward<T>(value)}; }
+    inline ErrValue Err(std::string error) { return {std::move(error)}; }
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace geode {
+    class Loader {
+    public:
+        static Loader* get() {
+            static Loader s_loader;
+            return &s_loader;
+        }
+
+        void queueInMainThread(std::function<void()> func) { m_queue.push_back(std::move(func)); }
+
+        /// @brief Run the functions queued so far, like the game does every frame. Stand-in only.
+        void runMainThreadQueue() {
+            auto queue = std::move(m_queue);
+            m_queue.clear();
+            for (auto& func : queue) {
+                func();
+            }
+        }
+
+    private:
+        std::vector<std::function<void()>> m_queue;
+    };
+
+    inline void queueInMainThread(std::function<void()> func) {
+        Loader::get()->queueInMainThread(std::move(func));
+    }
+}
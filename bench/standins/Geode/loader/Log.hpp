@@ -0,0 +1,23 @@
+#pragma once
+#include <fmt/format.h>
+
+#include <cstdio>
+
+namespace geode::log {
+    // warnings and errors are printed, so broken fonts show up in the benchmark output
+    template <class... Args>
+    void error(fmt::format_string<Args...> format, Args&&... args) {
+        fmt::print(stderr, "[error] {}\n", fmt::format(format, std::forward<Args>(args)...));
+    }
+
+    template <class... Args>
+    void warn(fmt::format_string<Args...> format, Args&&... args) {
+        fmt::print(stderr, "[warn] {}\n", fmt::format(format, std::forward<Args>(args)...));
+    }
+
+    template <class... Args>
+    void info(fmt::format_string<Args...>, Args&&...) {}
+
+    template <class... Args>
+    void debug(fmt::format_string<Args...>, Args&&...) {}
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <any>
+#include <map>
+#include <string>
+#include <string_view>
+
+namespace geode {
+    class Mod {
+    public:
+        static Mod* get() {
+            static Mod s_mod;
+            return &s_mod;
+        }
+
+        std::string const& getID() const { return m_id; }
+
+        template <class T>
+        T getSavedValue(std::string_view key, T const& defaultValue = T()) const {
+            auto it = m_savedValues.find(key);
+            auto value = it != m_savedValues.end() ? std::any_cast<T>(&it->second) : nullptr;
+            return value ? *value : defaultValue;
+        }
+
+        template <class T>
+        void setSavedValue(std::string_view key, T const& value) {
+            m_savedValues.insert_or_assign(std::string(key), value);
+        }
+
+    private:
+        std::string m_id = GEODE_MOD_ID;
+        std::map<std::string, std::any, std::less<>> m_savedValues;
+    };
+
+    inline Mod* getMod() {
+        return Mod::get();
+    }
+}
+
+inline std::string operator""_spr(const char* str, size_t size) {
+    return GEODE_MOD_ID "/" + std::string(str, size);
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include <Geode/loader/Mod.hpp>
+
+class GameManager {
+public:
+    void reloadAllStep5() {}
+};
+
+namespace geode {
+    // hooks are never installed headless, the modify class is just a subclass nobody instantiates
+    template <class Derived, class Base>
+    struct Modify : Base {};
+}
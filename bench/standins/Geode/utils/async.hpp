@@ -0,0 +1,22 @@
+#pragma once
+#include <memory>
+
+// Tasks of the stand-in runtime never run by themselves. Whoever spawned them completes them
+// (see web::MockServer), aborting only makes sure the completion is dropped.
+namespace arc {
+    template <class T = void>
+    class TaskHandle {
+    public:
+        TaskHandle() = default;
+        explicit TaskHandle(std::shared_ptr<bool> aborted) : m_aborted(std::move(aborted)) {}
+
+        void abort() {
+            if (m_aborted) *m_aborted = true;
+        }
+
+        bool isValid() const { return m_aborted != nullptr; }
+
+    private:
+        std::shared_ptr<bool> m_aborted;
+    };
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include <cocos2d.h>
+
+namespace geode::cocos {
+    template <class T>
+    class CCArrayExt {
+    public:
+        CCArrayExt(cocos2d::CCArray* array) : m_array(array) {}
+        T* begin() { return m_array ? reinterpret_cast<T*>(m_array->begin()) : nullptr; }
+        T* end() { return m_array ? reinterpret_cast<T*>(m_array->end()) : nullptr; }
+
+    private:
+        cocos2d::CCArray* m_array;
+    };
+}
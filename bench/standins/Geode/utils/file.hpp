@@ -0,0 +1,27 @@
+#pragma once
+#include <Geode/Result.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace geode::utils::file {
+    inline Result<std::string> readString(std::filesystem::path const& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            return Err("Unable to open file");
+        }
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        return Ok(contents.str());
+    }
+
+    inline Result<> writeString(std::filesystem::path const& path, std::string const& data) {
+        std::ofstream file(path, std::ios::binary);
+        if (!file || !file.write(data.data(), static_cast<std::streamsize>(data.size()))) {
+            return Err("Unable to write file");
+        }
+        return Ok();
+    }
+}
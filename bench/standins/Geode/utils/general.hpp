@@ -0,0 +1,17 @@
+#pragma once
+#include <Geode/Result.hpp>
+
+#include <charconv>
+#include <string_view>
+
+namespace geode::utils {
+    template <class T>
+    Result<T> numFromString(std::string_view str) {
+        T value{};
+        auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+        if (ec != std::errc()) {
+            return Err("Failed to parse number");
+        }
+        return Ok(value);
+    }
+}
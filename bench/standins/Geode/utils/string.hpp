@@ -0,0 +1,56 @@
+#pragma once
+#include <Geode/Result.hpp>
+
+#include <string>
+#include <string_view>
+
+namespace geode::utils::string {
+    inline Result<std::u32string> utf8ToUtf32(std::string_view str) {
+        std::u32string out;
+        out.reserve(str.size());
+        for (size_t i = 0; i < str.size();) {
+            auto lead = static_cast<unsigned char>(str[i]);
+            size_t length = lead < 0x80 ? 1 : (lead >> 5) == 0x6 ? 2 : (lead >> 4) == 0xE ? 3 : (lead >> 3) == 0x1E ? 4 : 0;
+            if (length == 0 || i + length > str.size()) {
+                return Err("Invalid UTF-8");
+            }
+
+            char32_t c = length == 1 ? lead : lead & (0x7F >> length);
+            for (size_t j = 1; j < length; ++j) {
+                auto next = static_cast<unsigned char>(str[i + j]);
+                if ((next & 0xC0) != 0x80) {
+                    return Err("Invalid UTF-8");
+                }
+                c = (c << 6) | (next & 0x3F);
+            }
+            out.push_back(c);
+            i += length;
+        }
+        return Ok(std::move(out));
+    }
+
+    inline Result<std::string> utf32ToUtf8(std::u32string_view str) {
+        std::string out;
+        out.reserve(str.size());
+        for (char32_t c : str) {
+            if (c < 0x80) {
+                out.push_back(static_cast<char>(c));
+            } else if (c < 0x800) {
+                out.push_back(static_cast<char>(0xC0 | (c >> 6)));
+                out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+            } else if (c < 0x10000) {
+                out.push_back(static_cast<char>(0xE0 | (c >> 12)));
+                out.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+            } else if (c < 0x110000) {
+                out.push_back(static_cast<char>(0xF0 | (c >> 18)));
+                out.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+            } else {
+                return Err("Invalid code point");
+            }
+        }
+        return Ok(std::move(out));
+    }
+}
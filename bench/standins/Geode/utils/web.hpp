@@ -0,0 +1,154 @@
+#pragma once
+#include <Geode/Result.hpp>
+#include <Geode/loader/Loader.hpp>
+#include <Geode/loader/Mod.hpp>
+#include <Geode/utils/async.hpp>
+#include <matjson.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace geode::utils::web {
+    class WebResponse {
+    public:
+        WebResponse() = default;
+        explicit WebResponse(int code, std::string body = "") : m_code(code), m_body(std::move(body)) {}
+
+        int code() const { return m_code; }
+        bool ok() const { return m_code >= 200 && m_code < 300; }
+        Result<std::string> string() const { return Ok(m_body); }
+        Result<matjson::Value> json() const { return matjson::parse(m_body); }
+
+    private:
+        int m_code = 0;
+        std::string m_body;
+    };
+
+    /// @brief Request handed to the stand-in network, nothing is sent anywhere.
+    struct WebFuture {
+        std::string method;
+        std::string url;
+        std::string body;
+        std::vector<std::pair<std::string, std::string>> headers;
+    };
+
+    class WebRequest {
+    public:
+        WebRequest& header(std::string_view name, std::string_view value) {
+            m_headers.emplace_back(name, value);
+            return *this;
+        }
+
+        WebRequest& bodyString(std::string_view body) {
+            m_body = body;
+            return *this;
+        }
+
+        WebFuture get(std::string_view url, Mod*) const { return {"GET", std::string(url), m_body, m_headers}; }
+        WebFuture put(std::string_view url, Mod*) const { return {"PUT", std::string(url), m_body, m_headers}; }
+        WebFuture post(std::string_view url, Mod*) const { return {"POST", std::string(url), m_body, m_headers}; }
+
+    private:
+        std::string m_body;
+        std::vector<std::pair<std::string, std::string>> m_headers;
+    };
+
+    /// @brief Stand-in network: spawned requests wait here until the test answers them, in any order.
+    class MockServer {
+    public:
+        struct Exchange {
+            WebFuture request;
+            std::function<void(WebResponse)> respond;
+            std::shared_ptr<bool> aborted;
+        };
+
+        static MockServer& get() {
+            static MockServer s_server;
+            return s_server;
+        }
+
+        void accept(Exchange exchange) {
+            ++m_received;
+            m_pending.push_back(std::move(exchange));
+        }
+
+        /// @brief Requests waiting for an answer. Aborted tasks cancel their request, so those are gone.
+        std::vector<Exchange> const& getPending() {
+            std::erase_if(m_pending, [](Exchange const& exchange) { return *exchange.aborted; });
+            return m_pending;
+        }
+
+        /// @brief Answer a request of getPending. The response reaches the task like a network thread would deliver it.
+        void respond(size_t index, WebResponse response) {
+            auto exchange = std::move(m_pending[index]);
+            m_pending.erase(m_pending.begin() + static_cast<ptrdiff_t>(index));
+            exchange.respond(std::move(response));
+        }
+
+        /// @brief Number of requests sent since the start.
+        size_t getReceivedCount() const { return m_received; }
+
+    private:
+        std::vector<Exchange> m_pending;
+        size_t m_received = 0;
+    };
+
+    /// @brief Links opened in the browser so far, nothing is opened. Stand-in only.
+    inline std::vector<std::string>& getOpenedLinks() {
+        static std::vector<std::string> s_links;
+        return s_links;
+    }
+
+    inline void openLinkInBrowser(std::string const& url) {
+        getOpenedLinks().push_back(url);
+    }
+}
+
+namespace geode::async {
+    template <class F>
+    arc::TaskHandle<void> spawn(utils::web::WebFuture future, F&& callback) {
+        auto aborted = std::make_shared<bool>(false);
+        utils::web::MockServer::get().accept({std::move(future), std::forward<F>(callback), aborted});
+        return arc::TaskHandle<void>(aborted);
+    }
+
+    /// @brief Holds one task at a time, spawning another one aborts the previous. The callback runs on the main thread.
+    template <class T>
+    class TaskHolder {
+    public:
+        TaskHolder() = default;
+        TaskHolder(TaskHolder const&) = delete;
+        TaskHolder& operator=(TaskHolder const&) = delete;
+        ~TaskHolder() { m_task.abort(); }
+
+        template <class F>
+        void spawn(utils::web::WebFuture future, F&& callback) {
+            m_task.abort();
+            auto aborted = std::make_shared<bool>(false);
+            utils::web::MockServer::get().accept({
+                std::move(future),
+                [aborted, callback = std::forward<F>(callback)](T value) mutable {
+                    Loader::get()->queueInMainThread([aborted, callback, value = std::move(value)]() mutable {
+                        if (!*aborted) callback(std::move(value));
+                    });
+                },
+                aborted,
+            });
+            m_task = arc::TaskHandle<void>(aborted);
+        }
+
+    private:
+        arc::TaskHandle<void> m_task;
+    };
+}
+
+// the real header brings the prelude along with the loader headers
+namespace geode::prelude {
+    using namespace ::geode;
+    using namespace ::geode::utils;
+}
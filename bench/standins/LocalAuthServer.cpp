@@ -0,0 +1,32 @@
+#include "LocalAuthServer.hpp"
+
+#include <utility>
+
+class LocalAuthServer::Impl {
+public:
+    std::function<bool(std::string, std::string)> callback;
+};
+
+// callback of the started server, nullptr while none listens
+static std::function<bool(std::string, std::string)>* s_listening = nullptr;
+
+void LocalAuthServer::start(std::function<bool(std::string code, std::string state)> onRedirect) {
+    stop();
+    m_impl = new Impl{std::move(onRedirect)};
+    s_listening = &m_impl->callback;
+}
+
+void LocalAuthServer::stop() {
+    if (m_impl && s_listening == &m_impl->callback) s_listening = nullptr;
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+bool redirectToLocalAuthServer(std::string const& code, std::string const& state) {
+    if (!s_listening || !*s_listening || !(*s_listening)(code, state)) {
+        return false;
+    }
+    // like the real server, it stops listening after the first accepted redirect
+    s_listening = nullptr;
+    return true;
+}
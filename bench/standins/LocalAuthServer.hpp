@@ -0,0 +1,10 @@
+#pragma once
+// Stand-in for the local redirect server (src/server), no port is opened. The test plays the browser with
+// redirectToLocalAuthServer, the way it would come back from the authorize page.
+#include <server/server.h>
+
+#include <string>
+
+/// @brief Send a redirect with these query values to the started LocalAuthServer.
+/// @return whether it was accepted, false if no server is listening
+bool redirectToLocalAuthServer(std::string const& code, std::string const& state);
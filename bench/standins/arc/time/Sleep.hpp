@@ -0,0 +1,37 @@
+#pragma once
+#include <Geode/utils/async.hpp>
+
+#include <cstdint>
+#include <memory>
+
+namespace asp {
+    class Duration {
+    public:
+        static Duration fromSecs(uint64_t secs) { return Duration(secs * 1000); }
+        static Duration fromMillis(uint64_t millis) { return Duration(millis); }
+
+        uint64_t millis() const { return m_millis; }
+
+    private:
+        explicit Duration(uint64_t millis) : m_millis(millis) {}
+        uint64_t m_millis;
+    };
+}
+
+namespace arc {
+    struct Sleep {
+        asp::Duration duration;
+    };
+
+    inline Sleep sleep(asp::Duration duration) {
+        return {duration};
+    }
+}
+
+namespace geode::async {
+    // timers of the stand-in runtime never fire, tests that need one call what it would have run themselves
+    template <class F>
+    arc::TaskHandle<void> spawn(arc::Sleep, F&&) {
+        return arc::TaskHandle<void>(std::make_shared<bool>(false));
+    }
+}
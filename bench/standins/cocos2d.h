@@ -0,0 +1,513 @@
+#pragma once
+// Stand-ins for the cocos2d-x classes used by the label code, so it can be compiled and timed headless.
+// Only the node state that layout reads and writes is kept. Drawing, GL calls and scheduling are no-ops.
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+typedef unsigned char GLubyte;
+typedef unsigned short GLushort;
+typedef int GLint;
+typedef unsigned int GLuint;
+typedef unsigned int GLenum;
+typedef float GLfloat;
+
+#define GL_SCISSOR_TEST 0x0C11
+#define GL_TEXTURE_2D 0x0DE1
+#define GL_RGBA 0x1908
+#define GL_UNSIGNED_BYTE 0x1401
+
+inline void glEnable(GLenum) {}
+inline bool glIsEnabled(GLenum) { return false; }
+inline void glUniform1f(GLint, GLfloat) {}
+inline void glDisable(GLenum) {}
+inline void glTexSubImage2D(GLenum, GLint, GLint, GLint, int, int, GLenum, GLenum, const void*) {}
+inline void kmGLPushMatrix() {}
+inline void kmGLPopMatrix() {}
+inline void kmGLTranslatef(float, float, float) {}
+
+#define CC_SAFE_DELETE(p) do { delete (p); (p) = nullptr; } while (0)
+
+#define kCCAttributeNamePosition "a_position"
+#define kCCAttributeNameColor "a_color"
+#define kCCAttributeNameTexCoord "a_texCoord"
+#define kCCShader_PositionTextureColor "ShaderPositionTextureColor"
+
+namespace cocos2d {
+    struct CCPoint {
+        float x = 0.f, y = 0.f;
+        constexpr CCPoint() = default;
+        constexpr CCPoint(float x, float y) : x(x), y(y) {}
+        CCPoint operator+(CCPoint const& other) const { return {x + other.x, y + other.y}; }
+        CCPoint operator-(CCPoint const& other) const { return {x - other.x, y - other.y}; }
+    };
+
+    struct CCSize {
+        float width = 0.f, height = 0.f;
+        constexpr CCSize() = default;
+        constexpr CCSize(float width, float height) : width(width), height(height) {}
+    };
+
+    struct CCRect {
+        CCPoint origin;
+        CCSize size;
+        constexpr CCRect() = default;
+        constexpr CCRect(float x, float y, float width, float height) : origin(x, y), size(width, height) {}
+        constexpr CCRect(CCPoint origin, CCSize size) : origin(origin), size(size) {}
+        float getMinX() const { return origin.x; }
+        float getMaxX() const { return origin.x + size.width; }
+        float getMinY() const { return origin.y; }
+        float getMaxY() const { return origin.y + size.height; }
+        bool containsPoint(CCPoint const& point) const {
+            return point.x >= getMinX() && point.x <= getMaxX() && point.y >= getMinY() && point.y <= getMaxY();
+        }
+    };
+
+    struct ccColor3B {
+        GLubyte r = 0, g = 0, b = 0;
+        bool operator==(ccColor3B const&) const = default;
+    };
+    struct ccColor4B { GLubyte r = 0, g = 0, b = 0, a = 0; };
+    struct ccColor4F { float r = 0.f, g = 0.f, b = 0.f, a = 0.f; };
+    inline ccColor3B ccc3(GLubyte r, GLubyte g, GLubyte b) { return {r, g, b}; }
+    inline CCPoint ccp(float x, float y) { return {x, y}; }
+
+    struct ccV3F_C4B_T2F { float vertices[3]; ccColor4B colors; float texCoords[2]; };
+    struct ccV3F_C4B_T2F_Quad { ccV3F_C4B_T2F bl, br, tl, tr; };
+
+    enum CCTexture2DPixelFormat { kCCTexture2DPixelFormat_RGBA8888 };
+    enum { kCCVertexAttrib_Position, kCCVertexAttrib_Color, kCCVertexAttrib_TexCoords };
+    extern const char* ccPositionTextureColor_vert;
+    inline void ccGLBindTexture2D(GLuint) {}
+
+    class CCObject {
+    public:
+        virtual ~CCObject() = default;
+        void retain() { ++m_uReference; }
+        void release() { if (--m_uReference == 0) delete this; }
+        CCObject* autorelease();
+        unsigned retainCount() const { return m_uReference; }
+
+    protected:
+        unsigned m_uReference = 1;
+    };
+
+    /// @brief Stand-in only: releases autoreleased objects, like the pool drained by cocos every frame.
+    void drainAutoreleasePool();
+
+    class CCArray : public CCObject {
+    public:
+        static CCArray* create() { return static_cast<CCArray*>((new CCArray())->autorelease()); }
+        ~CCArray() override { for (auto object : m_data) object->release(); }
+        unsigned count() const { return static_cast<unsigned>(m_data.size()); }
+        CCObject* objectAtIndex(unsigned index) const { return m_data[index]; }
+        void addObject(CCObject* object) { object->retain(); m_data.push_back(object); }
+        void removeObject(CCObject* object) {
+            auto it = std::find(m_data.begin(), m_data.end(), object);
+            if (it != m_data.end()) { m_data.erase(it); object->release(); }
+        }
+        void removeAllObjects() {
+            for (auto object : m_data) object->release();
+            m_data.clear();
+        }
+        CCObject** begin() { return m_data.data(); }
+        CCObject** end() { return m_data.data() + m_data.size(); }
+
+    protected:
+        std::vector<CCObject*> m_data;
+    };
+
+    class CCDictElement {
+    public:
+        CCDictElement(std::string key, CCObject* object) : m_key(std::move(key)), m_object(object) {}
+        const char* getStrKey() const { return m_key.c_str(); }
+        CCObject* getObject() const { return m_object; }
+
+    protected:
+        std::string m_key;
+        CCObject* m_object;
+    };
+
+    class CCDictionary : public CCObject {
+    public:
+        ~CCDictionary() override { for (auto element : m_elements) { element->getObject()->release(); delete element; } }
+        void setObject(CCObject* object, std::string const& key) { object->retain(); m_elements.push_back(new CCDictElement(key, object)); }
+        CCObject* objectForKey(std::string const& key) const {
+            for (auto element : m_elements) if (key == element->getStrKey()) return element->getObject();
+            return nullptr;
+        }
+        std::vector<CCDictElement*> m_elements;
+    };
+
+    #define CCDICT_FOREACH(dict, element) \
+        for (auto* _element_ : (dict)->m_elements) \
+            if (((element) = _element_), true)
+
+    class CCTexture2D : public CCObject {
+    public:
+        bool initWithData(const void*, CCTexture2DPixelFormat, unsigned width, unsigned height, CCSize const& size) {
+            m_uPixelsWide = width;
+            m_uPixelsHigh = height;
+            m_tContentSize = size;
+            return true;
+        }
+        unsigned getPixelsWide() const { return m_uPixelsWide; }
+        unsigned getPixelsHigh() const { return m_uPixelsHigh; }
+        CCSize const& getContentSize() const { return m_tContentSize; }
+        unsigned bitsPerPixelForFormat() const { return 32; }
+        GLuint getName() const { return 0; }
+        bool hasPremultipliedAlpha() const { return m_bHasPremultipliedAlpha; }
+        void setAntiAliasTexParameters() {}
+
+        unsigned m_uPixelsWide = 0;
+        unsigned m_uPixelsHigh = 0;
+        CCSize m_tContentSize;
+        bool m_bHasPremultipliedAlpha = false;
+    };
+
+    class CCTextureAtlas : public CCObject {
+    public:
+        unsigned getCapacity() const { return static_cast<unsigned>(m_quads.capacity()); }
+        void resize(unsigned count) { m_quads.resize(count); }
+
+    protected:
+        std::vector<ccV3F_C4B_T2F_Quad> m_quads;
+    };
+
+    class CCGLProgram : public CCObject {
+    public:
+        bool initWithVertexShaderByteArray(const char*, const char*) { return true; }
+        void addAttribute(const char*, GLuint) {}
+        bool link() { return true; }
+        void updateUniforms() {}
+        void use() {}
+        GLint getUniformLocationForName(const char*) { return 0; }
+        void setUniformLocationWith1f(GLint, GLfloat) {}
+        void setUniformLocationWith2f(GLint, GLfloat, GLfloat) {}
+        void setUniformLocationWith4f(GLint, GLfloat, GLfloat, GLfloat, GLfloat) {}
+    };
+
+    class CCShaderCache {
+    public:
+        static CCShaderCache* sharedShaderCache();
+        CCGLProgram* programForKey(const char* key) {
+            auto it = m_programs.find(key);
+            return it != m_programs.end() ? it->second : nullptr;
+        }
+        void addProgram(CCGLProgram* program, const char* key) { program->retain(); m_programs[key] = program; }
+
+    protected:
+        std::map<std::string, CCGLProgram*> m_programs;
+    };
+
+    class CCNode : public CCObject {
+    public:
+        ~CCNode() override {
+            if (m_pChildren) {
+                for (auto child : *m_pChildren) static_cast<CCNode*>(child)->m_pParent = nullptr;
+                m_pChildren->release();
+            }
+        }
+
+        static CCNode* create() { return static_cast<CCNode*>((new CCNode())->autorelease()); }
+        virtual bool init() { return true; }
+
+        virtual void setPosition(CCPoint const& position) { m_obPosition = position; }
+        void setPosition(float x, float y) { setPosition(CCPoint(x, y)); }
+        void setPositionX(float x) { setPosition(CCPoint(x, m_obPosition.y)); }
+        CCPoint const& getPosition() const { return m_obPosition; }
+        float getPositionX() const { return m_obPosition.x; }
+        virtual void setContentSize(CCSize const& size) { m_obContentSize = size; }
+        CCSize const& getContentSize() const { return m_obContentSize; }
+        float getContentWidth() const { return m_obContentSize.width; }
+        float getContentHeight() const { return m_obContentSize.height; }
+        CCSize getScaledContentSize() const { return {m_obContentSize.width * m_fScaleX, m_obContentSize.height * m_fScaleY}; }
+        float getScaledContentWidth() const { return m_obContentSize.width * m_fScaleX; }
+        virtual void setScale(float scale) { m_fScaleX = m_fScaleY = scale; }
+        virtual float getScale() { return m_fScaleX; }
+        void setScaleX(float scale) { m_fScaleX = scale; }
+        void setScaleY(float scale) { m_fScaleY = scale; }
+        float getScaleX() const { return m_fScaleX; }
+        void setAnchorPoint(CCPoint const& point) { m_obAnchorPoint = point; }
+        CCPoint const& getAnchorPoint() const { return m_obAnchorPoint; }
+        void setZOrder(int zOrder) { m_nZOrder = zOrder; }
+        void setVisible(bool visible) { m_bVisible = visible; }
+        bool isVisible() const { return m_bVisible; }
+        void setID(std::string const& id) { m_id = id; }
+        CCRect boundingBox() const { return {m_obPosition, getScaledContentSize()}; }
+
+        virtual void addChild(CCNode* child) { addChild(child, child->m_nZOrder, child->m_nTag); }
+        virtual void addChild(CCNode* child, int zOrder) { addChild(child, zOrder, child->m_nTag); }
+        virtual void addChild(CCNode* child, int zOrder, int tag) {
+            if (!m_pChildren) m_pChildren = new CCArray();
+            child->m_nZOrder = zOrder;
+            child->m_nTag = tag;
+            child->m_pParent = this;
+            m_pChildren->addObject(child);
+        }
+        void removeChild(CCNode* child) {
+            if (m_pChildren && child->m_pParent == this) {
+                child->m_pParent = nullptr;
+                m_pChildren->removeObject(child);
+            }
+        }
+        virtual void removeAllChildrenWithCleanup(bool) {
+            if (!m_pChildren) return;
+            for (auto child : *m_pChildren) static_cast<CCNode*>(child)->m_pParent = nullptr;
+            m_pChildren->removeAllObjects();
+        }
+        void removeFromParent() { if (m_pParent) m_pParent->removeChild(this); }
+        void removeFromParentAndCleanup(bool) { removeFromParent(); }
+        CCArray* getChildren() const { return m_pChildren; }
+        unsigned getChildrenCount() const { return m_pChildren ? m_pChildren->count() : 0; }
+        CCNode* getParent() const { return m_pParent; }
+
+        virtual void visit() {}
+        virtual void draw() {}
+        virtual void onEnter() {}
+        virtual void onExit() {}
+        void runAction(CCObject*) {}
+        void stopAllActions() {}
+        virtual void update(float) {}
+        virtual void sortAllChildren() {}
+        void transform() {}
+        void scheduleUpdate() {}
+        void unscheduleUpdate() {}
+        CCPoint convertToWorldSpace(CCPoint const& point) const { return point; }
+        CCPoint convertToNodeSpace(CCPoint const& point) const { return point; }
+
+        void setShaderProgram(CCGLProgram* program) { m_pShaderProgram = program; }
+        CCGLProgram* getShaderProgram() const { return m_pShaderProgram; }
+
+        CCPoint m_obPosition;
+        CCPoint m_obAnchorPoint;
+        CCSize m_obContentSize;
+        float m_fScaleX = 1.f;
+        float m_fScaleY = 1.f;
+        bool m_bVisible = true;
+        int m_nZOrder = 0;
+        int m_nTag = -1;
+        CCArray* m_pChildren = nullptr;
+        CCNode* m_pParent = nullptr;
+        CCGLProgram* m_pShaderProgram = nullptr;
+        std::string m_id;
+    };
+
+    class CCRGBAProtocol {
+    public:
+        virtual ~CCRGBAProtocol() = default;
+        virtual void setColor(ccColor3B const& color) = 0;
+        virtual ccColor3B const& getColor() = 0;
+        virtual ccColor3B const& getDisplayedColor() = 0;
+        virtual GLubyte getDisplayedOpacity() = 0;
+        virtual GLubyte getOpacity() = 0;
+        virtual void setOpacity(GLubyte opacity) = 0;
+        virtual void setOpacityModifyRGB(bool value) = 0;
+        virtual bool isOpacityModifyRGB() = 0;
+        virtual bool isCascadeColorEnabled() = 0;
+        virtual void setCascadeColorEnabled(bool enabled) = 0;
+        virtual void updateDisplayedColor(ccColor3B const& color) = 0;
+        virtual bool isCascadeOpacityEnabled() = 0;
+        virtual void setCascadeOpacityEnabled(bool enabled) = 0;
+        virtual void updateDisplayedOpacity(GLubyte opacity) = 0;
+    };
+
+    class CCLabelProtocol {
+    public:
+        virtual ~CCLabelProtocol() = default;
+        virtual void setString(const char* label) = 0;
+        virtual const char* getString() = 0;
+    };
+
+    class CCSpriteFrame : public CCObject {
+    public:
+        static CCSpriteFrame* createWithTexture(CCTexture2D*, CCRect const&) { return nullptr; }
+    };
+
+    class CCSpriteBatchNode;
+
+    class CCSprite : public CCNode, public CCRGBAProtocol {
+    public:
+        static CCSprite* createWithSpriteFrameName(const char*) { return nullptr; }
+        static CCSprite* create(const char*) { return nullptr; }
+        static CCSprite* createWithTexture(CCTexture2D* texture) {
+            return createWithTexture(texture, {0.f, 0.f, texture->getContentSize().width, texture->getContentSize().height});
+        }
+        static CCSprite* createWithTexture(CCTexture2D* texture, CCRect const& rect) {
+            auto sprite = new CCSprite();
+            sprite->initWithTexture(texture, rect);
+            sprite->autorelease();
+            return sprite;
+        }
+
+        ~CCSprite() override { if (m_pobTexture) m_pobTexture->release(); }
+
+        bool initWithTexture(CCTexture2D* texture, CCRect const& rect) {
+            setTexture(texture);
+            setTextureRect(rect, false, rect.size);
+            return true;
+        }
+
+        void setTexture(CCTexture2D* texture) {
+            if (texture) texture->retain();
+            if (m_pobTexture) m_pobTexture->release();
+            m_pobTexture = texture;
+        }
+        CCTexture2D* getTexture() const { return m_pobTexture; }
+
+        // like cocos, the texture coordinates of the quad are recomputed for every rect change
+        void setTextureRect(CCRect const& rect, bool, CCSize const& size) {
+            m_obRect = rect;
+            setContentSize(size);
+            float width = m_pobTexture && m_pobTexture->m_uPixelsWide ? static_cast<float>(m_pobTexture->m_uPixelsWide) : 1.f;
+            float height = m_pobTexture && m_pobTexture->m_uPixelsHigh ? static_cast<float>(m_pobTexture->m_uPixelsHigh) : 1.f;
+            float left = rect.origin.x / width, right = (rect.origin.x + rect.size.width) / width;
+            float top = rect.origin.y / height, bottom = (rect.origin.y + rect.size.height) / height;
+            m_sQuad.bl.texCoords[0] = left; m_sQuad.bl.texCoords[1] = bottom;
+            m_sQuad.br.texCoords[0] = right; m_sQuad.br.texCoords[1] = bottom;
+            m_sQuad.tl.texCoords[0] = left; m_sQuad.tl.texCoords[1] = top;
+            m_sQuad.tr.texCoords[0] = right; m_sQuad.tr.texCoords[1] = top;
+            m_bDirty = true;
+        }
+        void setTextureRect(CCRect const& rect) { setTextureRect(rect, false, rect.size); }
+        void setDisplayFrame(CCSpriteFrame*) {}
+        void setFlipY(bool) {}
+
+        void setColor(ccColor3B const& color) override { m_sColor = color; m_bDirty = true; }
+        ccColor3B const& getColor() override { return m_sColor; }
+        ccColor3B const& getDisplayedColor() override { return m_sColor; }
+        GLubyte getDisplayedOpacity() override { return m_nOpacity; }
+        GLubyte getOpacity() override { return m_nOpacity; }
+        void setOpacity(GLubyte opacity) override { m_nOpacity = opacity; m_bDirty = true; }
+        void setOpacityModifyRGB(bool value) override { m_bOpacityModifyRGB = value; }
+        bool isOpacityModifyRGB() override { return m_bOpacityModifyRGB; }
+        bool isCascadeColorEnabled() override { return false; }
+        void setCascadeColorEnabled(bool) override {}
+        void updateDisplayedColor(ccColor3B const&) override {}
+        bool isCascadeOpacityEnabled() override { return false; }
+        void setCascadeOpacityEnabled(bool) override {}
+        void updateDisplayedOpacity(GLubyte) override {}
+
+        bool m_bDirty = false;
+        CCSpriteBatchNode* m_pobBatchNode = nullptr;
+        CCTexture2D* m_pobTexture = nullptr;
+        CCRect m_obRect;
+        ccV3F_C4B_T2F_Quad m_sQuad{};
+        ccColor3B m_sColor{255, 255, 255};
+        GLubyte m_nOpacity = 255;
+        bool m_bOpacityModifyRGB = true;
+    };
+
+    class CCSpriteBatchNode : public CCNode {
+    public:
+        static CCSpriteBatchNode* create(const char* file);
+        static CCSpriteBatchNode* createWithTexture(CCTexture2D* texture) {
+            auto batch = new CCSpriteBatchNode();
+            batch->setTexture(texture);
+            batch->autorelease();
+            return batch;
+        }
+
+        ~CCSpriteBatchNode() override {
+            if (m_pobTexture) m_pobTexture->release();
+            m_pobTextureAtlas->release();
+        }
+
+        void setTexture(CCTexture2D* texture) {
+            if (texture) texture->retain();
+            if (m_pobTexture) m_pobTexture->release();
+            m_pobTexture = texture;
+        }
+        CCTexture2D* getTexture() const { return m_pobTexture; }
+        CCTextureAtlas* getTextureAtlas() const { return m_pobTextureAtlas; }
+
+        using CCNode::addChild;
+        void addChild(CCNode* child, int zOrder, int tag) override {
+            CCNode::addChild(child, zOrder, tag);
+            m_pobTextureAtlas->resize(getChildrenCount());
+        }
+        void removeAllChildrenWithCleanup(bool cleanup) override {
+            CCNode::removeAllChildrenWithCleanup(cleanup);
+            m_pobTextureAtlas->resize(0);
+        }
+
+    protected:
+        CCTexture2D* m_pobTexture = nullptr;
+        CCTextureAtlas* m_pobTextureAtlas = new CCTextureAtlas();
+    };
+
+    class CCTextureCache {
+    public:
+        static CCTextureCache* get();
+        static CCTextureCache* sharedTextureCache() { return get(); }
+        /// @brief Only reads the size of PNG files, nothing is decoded.
+        CCTexture2D* addImage(const char* path, bool);
+        CCTexture2D* textureForKey(const char* key) { return static_cast<CCTexture2D*>(m_pTextures->objectForKey(key)); }
+        void removeTextureForKey(const char*) {}
+
+        CCDictionary* m_pTextures = new CCDictionary();
+    };
+
+    class CCSpriteFrameCache {
+    public:
+        static CCSpriteFrameCache* get();
+        CCSpriteFrame* spriteFrameByName(const char*) { return nullptr; }
+    };
+
+    class CCDirector {
+    public:
+        static CCDirector* get();
+        static CCDirector* sharedDirector() { return get(); }
+        float getContentScaleFactor() const { return m_fContentScaleFactor; }
+        CCSize getWinSize() const { return {569.f, 320.f}; }
+
+        float m_fContentScaleFactor = 1.f;
+    };
+
+    class CCFileUtils {
+    public:
+        static CCFileUtils* get();
+        static CCFileUtils* sharedFileUtils() { return get(); }
+
+        /// @brief Stand-in only: directory searched for resources. Mod resource prefixes ("<mod id>/") are ignored.
+        void addSearchPath(std::string const& path) { m_searchPaths.push_back(path); }
+
+        std::string fullPathForFilename(const char* file, bool);
+        std::string fullPathFromRelativeFile(const char* file, const char* relativeTo);
+        unsigned char* getFileData(const char* file, const char* mode, unsigned long* size);
+
+    protected:
+        std::vector<std::string> m_searchPaths;
+    };
+
+    class CCConfiguration {
+    public:
+        static CCConfiguration* sharedConfiguration();
+        int m_nMaxTextureSize = 16384;
+    };
+
+    class CCEGLView {
+    public:
+        static CCEGLView* get();
+        static CCEGLView* sharedOpenGLView() { return get(); }
+        float getScaleX() const { return 1.f; }
+        bool isScissorEnabled() const { return false; }
+        CCRect getScissorRect() const { return {}; }
+        void setScissorInPoints(float, float, float, float) {}
+    };
+
+    class CCImage : public CCObject {
+    public:
+        enum ETextAlign { kAlignLeft = 0x31 };
+        // there is no font rasterizer here, so runtime glyphs are never available
+        bool initWithString(const char*, int, int, ETextAlign, const char*, int) { return false; }
+        unsigned char* getData() { return nullptr; }
+        unsigned short getWidth() const { return 0; }
+        unsigned short getHeight() const { return 0; }
+        bool hasAlpha() const { return true; }
+    };
+}
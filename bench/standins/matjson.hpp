@@ -0,0 +1,202 @@
+#pragma once
+// Minimal JSON value, enough for memory::toJson to produce real output and to read token endpoint responses.
+#include <Geode/Result.hpp>
+#include <fmt/format.h>
+
+#include <charconv>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace matjson {
+    class Value {
+    public:
+        Value() = default;
+        Value(std::string const& str) : m_kind(Kind::String), m_string(str) {}
+        Value(const char* str) : Value(std::string(str)) {}
+        Value(bool boolean) : m_kind(Kind::Bool), m_string(boolean ? "true" : "false") {}
+        template <class T> requires std::is_arithmetic_v<T>
+        Value(T number) : m_kind(Kind::Number), m_string(fmt::format("{}", number)) {}
+
+        static Value array() { Value value; value.m_kind = Kind::Array; return value; }
+        static Value object() { Value value; value.m_kind = Kind::Object; return value; }
+
+        /// @brief Member of an object, null if there is none.
+        Value const& operator[](std::string_view key) const {
+            static const Value s_null;
+            for (auto& [itemKey, value] : m_items) {
+                if (m_kind == Kind::Object && itemKey == key) return value;
+            }
+            return s_null;
+        }
+
+        geode::Result<std::string> asString() const {
+            if (m_kind != Kind::String) return geode::Err("not a string");
+            return geode::Ok(m_string);
+        }
+
+        geode::Result<int64_t> asInt() const {
+            int64_t number = 0;
+            auto [ptr, ec] = std::from_chars(m_string.data(), m_string.data() + m_string.size(), number);
+            if (m_kind != Kind::Number || ec != std::errc() || ptr != m_string.data() + m_string.size()) {
+                return geode::Err("not an integer");
+            }
+            return geode::Ok(number);
+        }
+
+        void push(Value value) { m_items.emplace_back(std::string(), std::move(value)); }
+        void set(std::string key, Value value) { m_items.emplace_back(std::move(key), std::move(value)); }
+
+        std::string dump(int indent = 4) const {
+            std::string out;
+            write(out, indent, 0);
+            return out;
+        }
+
+    private:
+        enum class Kind { Null, Bool, Number, String, Array, Object };
+
+        void write(std::string& out, int indent, int depth) const {
+            switch (m_kind) {
+                case Kind::Null: out += "null"; return;
+                case Kind::Bool:
+                case Kind::Number: out += m_string; return;
+                case Kind::String: out += quote(m_string); return;
+                default: break;
+            }
+
+            bool isObject = m_kind == Kind::Object;
+            out += isObject ? '{' : '[';
+            for (size_t i = 0; i < m_items.size(); ++i) {
+                out += i ? "," : "";
+                out += '\n' + std::string((depth + 1) * indent, ' ');
+                if (isObject) {
+                    out += quote(m_items[i].first) + ": ";
+                }
+                m_items[i].second.write(out, indent, depth + 1);
+            }
+            if (!m_items.empty()) {
+                out += '\n' + std::string(depth * indent, ' ');
+            }
+            out += isObject ? '}' : ']';
+        }
+
+        static std::string quote(std::string const& str) {
+            std::string out = "\"";
+            for (char c : str) {
+                if (c == '"' || c == '\\') out += '\\';
+                out += c;
+            }
+            return out + '"';
+        }
+
+        friend class Parser;
+
+        Kind m_kind = Kind::Null;
+        std::string m_string;
+        std::vector<std::pair<std::string, Value>> m_items;
+    };
+
+    /// @brief Strict enough for the responses the tests feed it, string escapes other than \" and \\ are kept as they are.
+    class Parser {
+    public:
+        explicit Parser(std::string_view text) : m_text(text) {}
+
+        bool parse(Value& out) {
+            return value(out) && (skipSpace(), m_pos == m_text.size());
+        }
+
+    private:
+        bool value(Value& out) {
+            skipSpace();
+            if (m_pos >= m_text.size()) return false;
+            char c = m_text[m_pos];
+            if (c == '{' || c == '[') {
+                bool isObject = c == '{';
+                out = isObject ? Value::object() : Value::array();
+                ++m_pos;
+                skipSpace();
+                if (consume(isObject ? '}' : ']')) return true;
+                do {
+                    std::string key;
+                    if (isObject && !(string(key) && (skipSpace(), consume(':')))) return false;
+                    Value item;
+                    if (!value(item)) return false;
+                    out.m_items.emplace_back(std::move(key), std::move(item));
+                    skipSpace();
+                } while (consume(','));
+                return consume(isObject ? '}' : ']');
+            }
+            if (c == '"') {
+                out.m_kind = Value::Kind::String;
+                return string(out.m_string);
+            }
+            for (std::string_view literal : {"true", "false", "null"}) {
+                if (m_text.substr(m_pos).starts_with(literal)) {
+                    m_pos += literal.size();
+                    out = literal == "null" ? Value() : Value(literal == "true");
+                    return true;
+                }
+            }
+            auto start = m_pos;
+            while (m_pos < m_text.size() && std::string_view("+-.eE0123456789").find(m_text[m_pos]) != std::string_view::npos) {
+                ++m_pos;
+            }
+            out.m_kind = Value::Kind::Number;
+            out.m_string = m_text.substr(start, m_pos - start);
+            return m_pos > start;
+        }
+
+        bool string(std::string& out) {
+            if (!consume('"')) return false;
+            for (; m_pos < m_text.size(); ++m_pos) {
+                char c = m_text[m_pos];
+                if (c == '"') {
+                    ++m_pos;
+                    return true;
+                }
+                if (c == '\\' && m_pos + 1 < m_text.size()) {
+                    c = m_text[++m_pos];
+                    if (c != '"' && c != '\\') out += '\\';
+                }
+                out += c;
+            }
+            return false;
+        }
+
+        bool consume(char c) {
+            if (m_pos < m_text.size() && m_text[m_pos] == c) {
+                ++m_pos;
+                return true;
+            }
+            return false;
+        }
+
+        void skipSpace() {
+            while (m_pos < m_text.size() && std::string_view(" \t\r\n").find(m_text[m_pos]) != std::string_view::npos) {
+                ++m_pos;
+            }
+        }
+
+        std::string_view m_text;
+        size_t m_pos = 0;
+    };
+
+    inline geode::Result<Value> parse(std::string_view text) {
+        Value value;
+        if (!Parser(text).parse(value)) return geode::Err("invalid JSON");
+        return geode::Ok(std::move(value));
+    }
+
+    inline Value makeObject(std::initializer_list<std::pair<std::string, Value>> entries) {
+        auto object = Value::object();
+        for (auto& [key, value] : entries) {
+            object.set(key, value);
+        }
+        return object;
+    }
+}
@@ -0,0 +1,131 @@
+#include <cocos2d.h>
+#include <Geode/loader/Mod.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace cocos2d {
+    const char* ccPositionTextureColor_vert = "";
+
+    static std::vector<CCObject*>& getAutoreleasePool() {
+        static std::vector<CCObject*> s_pool;
+        return s_pool;
+    }
+
+    CCObject* CCObject::autorelease() {
+        getAutoreleasePool().push_back(this);
+        return this;
+    }
+
+    void drainAutoreleasePool() {
+        auto pool = std::move(getAutoreleasePool());
+        getAutoreleasePool().clear();
+        for (auto object : pool) {
+            object->release();
+        }
+    }
+
+    CCShaderCache* CCShaderCache::sharedShaderCache() {
+        static CCShaderCache s_cache;
+        return &s_cache;
+    }
+
+    CCSpriteBatchNode* CCSpriteBatchNode::create(const char* file) {
+        auto texture = CCTextureCache::get()->addImage(file, false);
+        return texture ? createWithTexture(texture) : nullptr;
+    }
+
+    CCTextureCache* CCTextureCache::get() {
+        static CCTextureCache s_cache;
+        return &s_cache;
+    }
+
+    CCTexture2D* CCTextureCache::addImage(const char* path, bool) {
+        auto fullPath = CCFileUtils::get()->fullPathForFilename(path, false);
+        if (auto texture = static_cast<CCTexture2D*>(m_pTextures->objectForKey(fullPath))) {
+            return texture;
+        }
+
+        // width and height are the first fields of the IHDR chunk
+        unsigned char header[24];
+        std::ifstream file(fullPath, std::ios::binary);
+        if (!file.read(reinterpret_cast<char*>(header), sizeof(header)) || std::memcmp(header + 12, "IHDR", 4) != 0) {
+            return nullptr;
+        }
+        auto readU32 = [&](size_t offset) {
+            return unsigned(header[offset]) << 24 | unsigned(header[offset + 1]) << 16
+                | unsigned(header[offset + 2]) << 8 | unsigned(header[offset + 3]);
+        };
+
+        auto texture = new CCTexture2D();
+        auto width = readU32(16), height = readU32(20);
+        auto scale = CCDirector::get()->getContentScaleFactor();
+        texture->initWithData(nullptr, kCCTexture2DPixelFormat_RGBA8888, width, height, {width / scale, height / scale});
+        texture->m_bHasPremultipliedAlpha = true;
+        m_pTextures->setObject(texture, fullPath);
+        texture->release();
+        return texture;
+    }
+
+    CCSpriteFrameCache* CCSpriteFrameCache::get() {
+        static CCSpriteFrameCache s_cache;
+        return &s_cache;
+    }
+
+    CCDirector* CCDirector::get() {
+        static CCDirector s_director;
+        return &s_director;
+    }
+
+    CCFileUtils* CCFileUtils::get() {
+        static CCFileUtils s_fileUtils;
+        return &s_fileUtils;
+    }
+
+    std::string CCFileUtils::fullPathForFilename(const char* file, bool) {
+        std::string_view name = file;
+        std::string_view prefix = GEODE_MOD_ID "/";
+        if (name.starts_with(prefix)) {
+            name.remove_prefix(prefix.size());
+        }
+
+        for (auto& path : m_searchPaths) {
+            auto candidate = std::filesystem::path(path) / name;
+            if (std::filesystem::exists(candidate)) {
+                return candidate.string();
+            }
+        }
+        return std::string(name);
+    }
+
+    std::string CCFileUtils::fullPathFromRelativeFile(const char* file, const char* relativeTo) {
+        return (std::filesystem::path(relativeTo).parent_path() / file).string();
+    }
+
+    unsigned char* CCFileUtils::getFileData(const char* file, const char*, unsigned long* size) {
+        std::ifstream stream(fullPathForFilename(file, false), std::ios::binary | std::ios::ate);
+        if (!stream) {
+            *size = 0;
+            return nullptr;
+        }
+
+        *size = static_cast<unsigned long>(stream.tellg());
+        auto data = new unsigned char[*size];
+        stream.seekg(0);
+        stream.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(*size));
+        return data;
+    }
+
+    CCConfiguration* CCConfiguration::sharedConfiguration() {
+        static CCConfiguration s_configuration;
+        return &s_configuration;
+    }
+
+    CCEGLView* CCEGLView::get() {
+        static CCEGLView s_view;
+        return &s_view;
+    }
+}
@@ -26,7 +26,6 @@
 
 bool m_rebindWindowOpen = false;
 int m_rateLimitCounter = 0;
-async::TaskHolder<web::WebResponse> m_listener;
 
 $on_mod(Loaded) {
     #ifdef GEODE_IS_WINDOWS
@@ -41,10 +40,33 @@ $on_mod(Loaded) {
     auto dummy = Label::create("", "font_default.fnt"_spr);
     dummy->addAllFonts();
 
+    memory::registerCollector("fonts", [](std::vector<memory::Usage>& out) {
+        BMFontConfiguration::collectMemoryStats(out);
+        DynamicFontAtlas::collectMemoryStats(out);
+    });
+    memory::registerCollector("labels", Label::collectMemoryStats);
+    memory::registerCollector("textures", memory::collectModTextures);
+    memory::registerCollector("overlay", [](std::vector<memory::Usage>& out) {
+        if (auto overlay = OverlayManager::get()->getChildByType<MusicControlOverlay>(0)) {
+            overlay->collectMemoryStats(out);
+        }
+    });
+
+    if (Mod::get()->getSavedValue<bool>("hasAuthorized") && !SpotifyAuth::get()->hasPkceTokens()) {
+        // linked through the old auth proxy, its refresh token only works with the proxy's client secret
+        log::info("Spotify was linked through the old auth proxy, asking to link again");
+        Mod::get()->setSavedValue("hasAuthorized", false);
+    }
+
     if (Mod::get()->getSavedValue<bool>("hasAuthorized") && !PlaybackManager::get().isWindows()) {
-        SpotifyAuth::get()->refresh([](std::string newToken) {
-            log::debug("Token refreshed on load");
-        });
+        // a token from the last session may still be good for a while
+        if (SpotifyAuth::get()->isTokenFresh()) {
+            SpotifyAuth::get()->scheduleRefresh();
+        } else {
+            SpotifyAuth::get()->refresh([](std::string newToken) {
+                if (!newToken.empty()) log::debug("Token refreshed on load");
+            });
+        }
     }
 
     listenForKeybindSettingPresses("key_overlay", [](Keybind key, bool down, bool repeat, double time) {
@@ -61,46 +83,7 @@ $on_mod(Loaded) {
             createQuickPopup("Link Spotify", "Please link your Spotify account to use Music Integrations <cc>(You will have 2 minutes to authenticate)</c>", "Link Now", "Close",
                 [](auto, bool btn2) {
                     if (btn2) return;
-                    SpotifyAuth::get()->start([](std::string code) {
-                        auto req = web::WebRequest();
-
-                        m_listener.spawn(
-                            req.post("https://craftify.thatgravyboat.tech/api/v1/public/auth?type=auth&code=" + code, geode::getMod()),
-                            [](web::WebResponse value) {
-                                auto jsonResult = value.json();
-                                if (!jsonResult.isOk()) {
-                                    log::error("Failed to parse JSON response");
-                                    return;
-                                }
-                                
-                                auto jsonUnwrap = jsonResult.unwrap();
-                                if (!jsonUnwrap.contains("access_token")) {
-                                    log::error("No access_token in response!");
-                                    return;
-                                }
-                                
-                                auto tokenResult = jsonUnwrap["access_token"].asString();
-                                if (!tokenResult.isOk()) {
-                                    log::error("Failed to get access_token as string");
-                                    return;
-                                }
-
-                                auto refreshResult = jsonUnwrap["refresh_token"].asString();
-                                if (!refreshResult.isOk()) {
-                                    log::error("Failed to get refresh_token as string");
-                                    return;
-                                }
-                                
-                                std::string token = tokenResult.unwrap();
-                                std::string refresh = refreshResult.unwrap();
-                                Mod::get()->setSavedValue("spotify-token", token);
-                                Mod::get()->setSavedValue("spotify-refresh", refresh);
-                                log::info("Successfully saved Spotify token");
-                                Mod::get()->setSavedValue("hasAuthorized", true);
-                            }
-                        );
-                    });
-                    web::openLinkInBrowser("https://accounts.spotify.com/authorize?client_id=7314a0ab3c734b2caa4b483032cdd91f&response_type=code&redirect_uri=http://127.0.0.1:21851/&scope=user-read-playback-state user-modify-playback-state");
+                    SpotifyAuth::get()->authorize();
                 }
             );
         }
@@ -1,294 +1,334 @@
 #include "AdvancedLabelManager.hpp"
+#include "../utils/Unicode.hpp"
 #include <Geode/loader/Log.hpp>
+#include <Geode/utils/cocos.hpp>
 #include <Geode/utils/general.hpp>
 #include <Geode/utils/string.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <iostream>
+#include <latch>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 #include <Geode/modify/GameManager.hpp>
 struct ClearCacheGMHook : geode::Modify<ClearCacheGMHook, GameManager> {
     void reloadAllStep5() {
         GameManager::reloadAllStep5();
         BMFontConfiguration::purgeCachedData();
+        DynamicFontAtlas::purgeCachedData();
+        Label::reloadRuntimeFallbacks();
     }
 };
 
-std::unordered_map<std::string, BMFontConfiguration>& getFontConfigs() {
-    static std::unordered_map<std::string, BMFontConfiguration> s_fontConfigs;
-    return s_fontConfigs;
+std::unordered_map<std::string, std::shared_ptr<DynamicFontAtlas>>& getDynamicAtlases() {
+    static std::unordered_map<std::string, std::shared_ptr<DynamicFontAtlas>> s_atlases;
+    return s_atlases;
 }
 
-BMFontConfiguration* BMFontConfiguration::create(std::string const& fntFile) {
-    auto& s_fontConfigs = getFontConfigs();
-
-    // check if the font config is already loaded
-    auto it = s_fontConfigs.find(fntFile);
-    if (it != s_fontConfigs.end()) {
-        return &it->second;
-    }
+constexpr bool isRegionalIndicator(char32_t c) {
+    return c >= 0x1F1E6 && c <= 0x1F1FF;
+}
 
-    // load the font config
-    BMFontConfiguration config{};
-    if (!config.initWithFNTfile(fntFile)) {
-        return nullptr;
-    }
-    return &s_fontConfigs.emplace(fntFile, std::move(config)).first->second;
+constexpr static bool isEmoji(char32_t c) {
+    return (c >= 0x1F300 && c <= 0x1F6FF)    // Emoticons, transport, weather
+           || (c >= 0x2600 && c <= 0x27BF)   // Miscellaneous Symbols and Dingbats
+           || (c >= 0x2000 && c <= 0x23FF)   // General Punctuation, Super/subscripts, Diacritical marks, etc.
+           || (c >= 0x2B50 && c <= 0x2B55)   // Star emojis
+           || (c >= 0x1F900 && c <= 0x1F9FF) // Supplemental Symbols and Pictographs
+           || (c >= 0x1F700 && c <= 0x1F7FF) // Alchemical Symbols
+           || (c >= 0x1FA00 && c <= 0x1FAFF) // Symbols and Pictographs Extended-A
+           || (c >= 0x1F000 && c <= 0x1F02F) // Mahjong, Domino
+           || (c >= 0xE0020 && c <= 0xE007F) // Tags for flags
+           || (c >= 0x1C000 && c <= 0x1CFFF) // Custom range for special emojis
+           || c == 0x20E3;                   // Combining enclosing keycap
 }
 
-void BMFontConfiguration::purgeCachedData() {
-    getFontConfigs().clear();
+constexpr static bool isSkinToneModifier(char32_t c) {
+    return c >= 0x1F3FB && c <= 0x1F3FF;
 }
 
-bool BMFontConfiguration::initWithFNTfile(std::string const& fntFile) {
-    #if defined(GEODE_IS_MOBILE) || !defined(NDEBUG)
-    // on android, accessing internal assets manually won't work,
-    // so we're just going to use cocos functions as intended.
-    // oh and fullPathForFilename apparently crashes in debug mode, so we're using this in that case as well
-    unsigned long size = 0;
-    auto data = cocos2d::CCFileUtils::sharedFileUtils()->getFileData(fntFile.c_str(), "rb", &size);
-    if (!data || size == 0) {
-        geode::log::error("Failed to read file '{}'", fntFile);
-        return false;
-    }
-    auto contents = std::string(reinterpret_cast<char*>(data), size);
-    #else
-    // for non-android, we can speed up reading by doing it manually
-    std::string fullPath = cocos2d::CCFileUtils::get()->fullPathForFilename(fntFile.c_str(), false);
-    auto contents = geode::utils::file::readString(fullPath).unwrapOrDefault();
-    if (contents.empty()) {
-        geode::log::error("Failed to read file '{}'", fullPath);
-        return false;
-    }
-    #endif
+constexpr static bool isZeroWidthJoiner(char32_t c) {
+    return c == 0x200D;
+}
 
-    return initWithContents(contents, fntFile);
+constexpr static bool isVariationSelector(char32_t c) {
+    return c >= 0xFE00 && c <= 0xFE0F;
 }
 
-#define WRAP_PARSE(expr) if (auto res = (expr); res.isErr()) { geode::log::error("{}", res.unwrapErr()); return false; }
+constexpr static bool isDigit(char32_t c) {
+    return c <= 0x0039 && c >= 0x0030;
+}
 
-bool BMFontConfiguration::initWithContents(std::string const& contents, std::string const& fntFile) {
-    std::istringstream stream(contents);
-    std::string line;
+constexpr static bool shouldParseDigitRegionalIndicator(std::u32string_view text) {
+    return isDigit(text[0]) && text.size() > 2 && text[2] == 0x20E3 && isVariationSelector(text[1]);
+}
 
-    while (std::getline(stream, line)) {
-        if (line.empty()) {
-            continue;
-        }
+EmojiTrie const& EmojiTrie::get(const Map* map) {
+    static std::unordered_map<const Map*, EmojiTrie> s_tries;
 
-        std::istringstream lineStream(line);
-        std::string type;
-        lineStream >> type;
-
-        if (type == "info") {
-            WRAP_PARSE(parseInfoArguments(lineStream));
-        } else if (type == "common") {
-            WRAP_PARSE(parseCommonArguments(lineStream));
-        } else if (type == "page") {
-            WRAP_PARSE(parseImageFileName(lineStream, fntFile));
-        } else if (type == "char") {
-            WRAP_PARSE(parseCharacterDefinition(lineStream));
-        } else if (type == "kerning") {
-            WRAP_PARSE(parseKerningEntry(lineStream));
-        }
+    auto it = s_tries.find(map);
+    if (it != s_tries.end()) {
+        return it->second;
     }
 
-    return true;
+    return s_tries.emplace(map, EmojiTrie(*map)).first->second;
 }
 
-template <class T>
-T fastParse(std::string_view str) {
-    return geode::utils::numFromString<T>(str).unwrapOrDefault();
-}
+EmojiTrie::EmojiTrie(Map const& map) {
+    // build a temporary pointer-based trie first
+    struct BuildNode {
+        std::map<char32_t, uint32_t> children;
+        const char* value = nullptr;
+    };
 
-geode::Result<> BMFontConfiguration::parseInfoArguments(std::istringstream& line) {
-    std::string keypair;
+    std::vector<BuildNode> nodes(1);
+    for (auto& [sequence, frameName] : map) {
+        uint32_t current = 0;
+        for (auto c : sequence) {
+            auto it = nodes[current].children.find(c);
+            if (it != nodes[current].children.end()) {
+                current = it->second;
+                continue;
+            }
 
-    while (line >> keypair) {
-        auto eqPos = keypair.find('=');
-        if (eqPos == std::string::npos) {
-            continue;
+            auto next = static_cast<uint32_t>(nodes.size());
+            nodes[current].children.emplace(c, next);
+            nodes.emplace_back();
+            current = next;
         }
+        nodes[current].value = frameName;
+    }
 
-        auto key = keypair.substr(0, eqPos);
-        auto value = keypair.substr(eqPos + 1);
+    // flatten it in breadth-first order, so that the edges of each node are contiguous
+    m_nodes.reserve(nodes.size());
+    m_edges.reserve(nodes.size() - 1);
 
-        if (key == "padding") {
-            std::istringstream paddingStream(value);
-            char comma;
-            paddingStream >> m_padding.left >> comma >> m_padding.top >> comma >> m_padding.right >> comma >> m_padding.bottom;
+    std::vector<uint32_t> order;
+    order.reserve(nodes.size());
+    order.push_back(0);
+
+    std::vector<uint32_t> remap(nodes.size(), 0);
+    for (size_t i = 0; i < order.size(); ++i) {
+        for (auto& [c, child] : nodes[order[i]].children) {
+            remap[child] = static_cast<uint32_t>(order.size());
+            order.push_back(child);
         }
     }
 
-    return geode::Ok();
+    for (auto oldIndex : order) {
+        auto& node = nodes[oldIndex];
+        m_nodes.push_back({
+            static_cast<uint32_t>(m_edges.size()),
+            static_cast<uint32_t>(node.children.size()),
+            node.value
+        });
+        for (auto& [c, child] : node.children) {
+            m_edges.push_back({c, remap[child]});
+        }
+    }
 }
 
-geode::Result<> BMFontConfiguration::parseImageFileName(std::istringstream& line, std::string const& fntFile) {
-    std::string keypair;
-
-    while (line >> keypair) {
-        auto eqPos = keypair.find('=');
-        if (eqPos == std::string::npos) {
-            continue;
+const char* EmojiTrie::match(std::u32string_view text, size_t& outLength) const {
+    const char* result = nullptr;
+    outLength = 0;
+
+    uint32_t current = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        auto& node = m_nodes[current];
+        auto begin = m_edges.begin() + node.firstEdge;
+        auto end = begin + node.edgeCount;
+        auto it = std::lower_bound(begin, end, text[i], [](Edge const& edge, char32_t c) {
+            return edge.codepoint < c;
+        });
+        if (it == end || it->codepoint != text[i]) {
+            break;
         }
 
-        auto key = keypair.substr(0, eqPos);
-        auto value = keypair.substr(eqPos + 1);
-
-        if (key == "file") {
-            auto relPath = value.substr(1, value.size() - 2); // remove quotes
-            m_atlasName = cocos2d::CCFileUtils::get()->fullPathFromRelativeFile(
-                relPath.c_str(), fntFile.c_str()
-            );
+        current = it->node;
+        if (m_nodes[current].value) {
+            result = m_nodes[current].value;
+            outLength = i + 1;
         }
     }
 
-    if (m_atlasName.empty()) {
-        return geode::Err("Failed to parse image file name");
-    }
-
-    return geode::Ok();
+    return result;
 }
 
-geode::Result<> BMFontConfiguration::parseCommonArguments(std::istringstream& line) {
-    std::string keypair;
-
-    while (line >> keypair) {
-        auto eqPos = keypair.find('=');
-        if (eqPos == std::string::npos) {
-            continue;
-        }
+bool EmojiTrie::startsSequence(char32_t c) const {
+    auto& root = m_nodes.front();
+    auto begin = m_edges.begin() + root.firstEdge;
+    auto end = begin + root.edgeCount;
+    auto it = std::lower_bound(begin, end, c, [](Edge const& edge, char32_t c) {
+        return edge.codepoint < c;
+    });
+    return it != end && it->codepoint == c;
+}
 
-        auto key = keypair.substr(0, eqPos);
-        auto value = keypair.substr(eqPos + 1);
+// size of the runtime rasterized atlas page, in texels
+constexpr int DYNAMIC_ATLAS_SIZE = 1024;
+
+#if defined(GEODE_IS_WINDOWS)
+constexpr auto SYSTEM_UI_FONT = "Segoe UI";
+#elif defined(GEODE_IS_MACOS) || defined(GEODE_IS_IOS)
+constexpr auto SYSTEM_UI_FONT = "Helvetica";
+#else
+constexpr auto SYSTEM_UI_FONT = ""; // default typeface
+#endif
+
+std::shared_ptr<DynamicFontAtlas> DynamicFontAtlas::get(std::string const& fontName, float lineHeight) {
+    // glyphs are rasterized a bit smaller than the line, like the em box of the bundled fonts
+    auto fontSize = std::max(8, static_cast<int>(std::round(lineHeight * 0.8f)));
+    auto key = fmt::format("{}@{}", fontName, fontSize);
+
+    auto& atlases = getDynamicAtlases();
+    auto it = atlases.find(key);
+    if (it != atlases.end()) {
+        return it->second;
+    }
 
-        if (key == "lineHeight") {
-            m_commonHeight = fastParse<float>(value);
-        } else if (key == "scaleW" || key == "scaleH") {
-            if (fastParse<int>(value) > cocos2d::CCConfiguration::sharedConfiguration()->m_nMaxTextureSize) {
-                return geode::Err("Font size exceeds max texture size");
-            }
-        } else if (key == "pages") {
-            if (fastParse<int>(value) != 1) {
-                return geode::Err("Font must have exactly one page");
-            }
-        }
+    auto atlas = std::make_shared<DynamicFontAtlas>();
+    if (!atlas->init(fontName, fontSize)) {
+        geode::log::warn("Failed to create runtime font atlas for '{}'", key);
+        return nullptr;
     }
 
-    return geode::Ok();
+    return atlases.emplace(key, std::move(atlas)).first->second;
 }
 
-geode::Result<> BMFontConfiguration::parseCharacterDefinition(std::istringstream& line) {
-    BMFontDef def;
-    std::string keypair;
-
-    while (line >> keypair) {
-        auto eqPos = keypair.find('=');
-        if (eqPos == std::string::npos) {
-            continue;
-        }
+void DynamicFontAtlas::purgeCachedData() {
+    getDynamicAtlases().clear();
+}
 
-        auto key = keypair.substr(0, eqPos);
-        auto value = keypair.substr(eqPos + 1);
-
-        if (key == "id") {
-            def.charID = fastParse<uint32_t>(value);
-        } else if (key == "x") {
-            def.rect.origin.x = fastParse<int>(value);
-        } else if (key == "y") {
-            def.rect.origin.y = fastParse<int>(value);
-        } else if (key == "width") {
-            def.rect.size.width = fastParse<int>(value);
-        } else if (key == "height") {
-            def.rect.size.height = fastParse<int>(value);
-        } else if (key == "xoffset") {
-            def.xOffset = fastParse<float>(value);
-        } else if (key == "yoffset") {
-            def.yOffset = fastParse<float>(value);
-        } else if (key == "xadvance") {
-            def.xAdvance = fastParse<float>(value);
-        }
+void DynamicFontAtlas::collectMemoryStats(std::vector<memory::Usage>& out) {
+    // runtime atlases own their texture, it isn't in the texture cache
+    for (auto& [key, atlas] : getDynamicAtlases()) {
+        out.push_back({
+            fmt::format("runtime {}", key),
+            atlas->getMemoryUsage() + memory::getTextureBytes(atlas->getTexture()),
+            atlas->getFontDefDictionary().size()
+        });
     }
+}
 
-    m_fontDefDictionary[def.charID] = def;
-    // m_characterSet.insert(def.charID);
-
-    return geode::Ok();
+DynamicFontAtlas::~DynamicFontAtlas() {
+    if (m_texture) {
+        m_texture->release();
+    }
 }
 
-geode::Result<> BMFontConfiguration::parseKerningEntry(std::istringstream& line) {
-    std::string keypair;
+bool DynamicFontAtlas::init(std::string const& fontName, int fontSize) {
+    m_fontName = fontName.empty() ? SYSTEM_UI_FONT : fontName;
+    m_fontSize = fontSize;
 
-    while (line >> keypair) {
-        auto eqPos = keypair.find('=');
-        if (eqPos == std::string::npos) {
-            continue;
-        }
+    // the rasterized line height decides how glyphs are scaled to the label font
+    std::vector<uint8_t> pixels;
+    int width, height;
+    if (!rasterize("Ag", pixels, width, height)) {
+        return false;
+    }
+    m_commonHeight = static_cast<float>(height);
+    m_spacing = {1, 1};
+
+    std::vector<uint8_t> empty(DYNAMIC_ATLAS_SIZE * DYNAMIC_ATLAS_SIZE * 4, 0);
+    m_texture = new cocos2d::CCTexture2D();
+    if (!m_texture->initWithData(
+        empty.data(), cocos2d::kCCTexture2DPixelFormat_RGBA8888,
+        DYNAMIC_ATLAS_SIZE, DYNAMIC_ATLAS_SIZE,
+        cocos2d::CCSize(DYNAMIC_ATLAS_SIZE, DYNAMIC_ATLAS_SIZE)
+    )) {
+        m_texture->release();
+        m_texture = nullptr;
+        return false;
+    }
 
-        auto key = keypair.substr(0, eqPos);
-        auto value = keypair.substr(eqPos + 1);
+    return true;
+}
 
-        if (key == "first") {
-            auto first = fastParse<uint32_t>(value);
-            line >> keypair;
-            eqPos = keypair.find('=');
-            if (eqPos == std::string::npos) {
-                return geode::Err("Failed to parse kerning entry first");
-            }
+bool DynamicFontAtlas::rasterize(std::string const& text, std::vector<uint8_t>& outPixels, int& outWidth, int& outHeight) const {
+    auto image = new cocos2d::CCImage();
+    bool drawn = image->initWithString(
+        text.c_str(), 0, 0, cocos2d::CCImage::kAlignLeft,
+        m_fontName.c_str(), m_fontSize
+    );
 
-            auto second = fastParse<uint32_t>(keypair.substr(eqPos + 1));
-            line >> keypair;
-            eqPos = keypair.find('=');
-            if (eqPos == std::string::npos) {
-                return geode::Err("Failed to parse kerning entry second");
-            }
+    auto data = image->getData();
+    outWidth = image->getWidth();
+    outHeight = image->getHeight();
+    if (!drawn || !data || outWidth == 0 || outHeight == 0) {
+        image->release();
+        return false;
+    }
 
-            auto amount = fastParse<float>(keypair.substr(eqPos + 1));
-            m_kerningDictionary[{first, second}] = amount;
-        }
+    // platforms disagree on the output (white on transparent, premultiplied or not, white on black),
+    // so take the coverage from whichever channels carry it
+    size_t stride = image->hasAlpha() ? 4 : 3;
+    size_t pixelCount = static_cast<size_t>(outWidth) * outHeight;
+    bool hasCoverage = false;
+    outPixels.resize(pixelCount * 4);
+    for (size_t i = 0; i < pixelCount; ++i) {
+        auto pixel = data + i * stride;
+        uint8_t alpha = stride == 4 ? pixel[3] : 255;
+        uint8_t coverage = std::min(alpha, std::max({pixel[0], pixel[1], pixel[2]}));
+        outPixels[i * 4 + 0] = 255;
+        outPixels[i * 4 + 1] = 255;
+        outPixels[i * 4 + 2] = 255;
+        outPixels[i * 4 + 3] = coverage;
+        hasCoverage |= coverage != 0;
     }
 
-    return geode::Ok();
+    image->release();
+    return hasCoverage;
 }
 
-#undef WRAP_PARSE
+const BMFontDef* DynamicFontAtlas::getGlyph(char32_t c) {
+    auto it = m_fontDefDictionary.find(c);
+    if (it != m_fontDefDictionary.end()) {
+        return &it->second;
+    }
 
+    if (m_full || m_missing.contains(c)) {
+        return nullptr;
+    }
 
-constexpr bool isRegionalIndicator(char32_t c) {
-    return c >= 0x1F1E6 && c <= 0x1F1FF;
-}
+    std::vector<uint8_t> pixels;
+    int width, height;
+    auto utf8 = geode::utils::string::utf32ToUtf8(std::u32string_view(&c, 1));
+    if (utf8.isErr() || !rasterize(utf8.unwrap(), pixels, width, height)) {
+        m_missing.insert(c);
+        return nullptr;
+    }
 
-constexpr static bool isEmoji(char32_t c) {
-    return (c >= 0x1F300 && c <= 0x1F6FF)    // Emoticons, transport, weather
-           || (c >= 0x2600 && c <= 0x27BF)   // Miscellaneous Symbols and Dingbats
-           || (c >= 0x2000 && c <= 0x23FF)   // General Punctuation, Super/subscripts, Diacritical marks, etc.
-           || (c >= 0x2B50 && c <= 0x2B55)   // Star emojis
-           || (c >= 0x1F900 && c <= 0x1F9FF) // Supplemental Symbols and Pictographs
-           || (c >= 0x1F700 && c <= 0x1F7FF) // Alchemical Symbols
-           || (c >= 0x1FA00 && c <= 0x1FAFF) // Symbols and Pictographs Extended-A
-           || (c >= 0x1F000 && c <= 0x1F02F) // Mahjong, Domino
-           || (c >= 0xE0020 && c <= 0xE007F) // Tags for flags
-           || (c >= 0x1C000 && c <= 0x1CFFF) // Custom range for special emojis
-           || c == 0x20E3;                   // Combining enclosing keycap
-}
+    // shelf packing, with a texel between glyphs so sampling never bleeds into a neighbour
+    if (m_cursorX + width > DYNAMIC_ATLAS_SIZE) {
+        m_cursorX = 0;
+        m_cursorY += m_shelfHeight + 1;
+        m_shelfHeight = 0;
+    }
 
-constexpr static bool isSkinToneModifier(char32_t c) {
-    return c >= 0x1F3FB && c <= 0x1F3FF;
-}
+    if (width > DYNAMIC_ATLAS_SIZE || m_cursorY + height > DYNAMIC_ATLAS_SIZE) {
+        m_full = true;
+        geode::log::warn("Runtime font atlas is full, U+{:04X} and further glyphs won't be drawn", static_cast<uint32_t>(c));
+        return nullptr;
+    }
 
-constexpr static bool isZeroWidthJoiner(char32_t c) {
-    return c == 0x200D;
-}
+    cocos2d::ccGLBindTexture2D(m_texture->getName());
+    glTexSubImage2D(GL_TEXTURE_2D, 0, m_cursorX, m_cursorY, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
 
-constexpr static bool isVariationSelector(char32_t c) {
-    return c >= 0xFE00 && c <= 0xFE0F;
-}
+    BMFontDef def;
+    def.charID = c;
+    def.rect = cocos2d::CCRect(m_cursorX, m_cursorY, width, height);
+    def.xAdvance = static_cast<float>(width);
 
-constexpr static bool isDigit(char32_t c) {
-    return c <= 0x0039 && c >= 0x0030;
-}
+    m_cursorX += width + 1;
+    m_shelfHeight = std::max(m_shelfHeight, height);
 
-constexpr static bool shouldParseDigitRegionalIndicator(std::u32string_view text) {
-    return isDigit(text[0]) && text.size() > 2 && text[2] == 0x20E3 && isVariationSelector(text[1]);
+    return &m_fontDefDictionary.emplace(c, def).first->second;
 }
 
 // Custom math stuff
@@ -400,24 +440,276 @@ Label* Label::createWrapped(
     return nullptr;
 }
 
+/// @brief Worker threads for label layout, started on first use and joined when the pool is destroyed at exit.
+class LayoutThreadPool {
+public:
+    static LayoutThreadPool& get() {
+        static LayoutThreadPool s_pool;
+        return s_pool;
+    }
+
+    LayoutThreadPool(LayoutThreadPool const&) = delete;
+    LayoutThreadPool& operator=(LayoutThreadPool const&) = delete;
+
+    ~LayoutThreadPool() {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+
+        for (auto& worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    /// @brief Call fn(i) for every i in [0, count) on the workers and the calling thread, and wait for all of them.
+    template <typename F>
+    void parallelFor(size_t count, F&& fn) {
+        std::atomic<size_t> next = 0;
+        auto run = [&] {
+            for (size_t i; (i = next.fetch_add(1)) < count;) {
+                fn(i);
+            }
+        };
+
+        auto helpers = std::min(m_workers.size(), count > 0 ? count - 1 : 0);
+        std::latch done(static_cast<ptrdiff_t>(helpers));
+        {
+            std::lock_guard lock(m_mutex);
+            for (size_t i = 0; i < helpers; ++i) {
+                m_jobs.emplace_back([&] {
+                    run();
+                    done.count_down();
+                });
+            }
+        }
+        m_wake.notify_all();
+
+        run();
+        done.wait();
+    }
+
+private:
+    LayoutThreadPool() {
+        // leave a core for the main thread, there's nothing to gain from a big pool for text
+        auto cores = std::thread::hardware_concurrency();
+        auto workerCount = std::clamp<size_t>(cores > 1 ? cores - 1 : 0, 0, 4);
+        m_workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; ++i) {
+            m_workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    void workerLoop() {
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock lock(m_mutex);
+                m_wake.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+                // parallelFor waits for its jobs, so the queue is empty once the pool is destroyed
+                if (m_jobs.empty()) {
+                    return;
+                }
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+            job();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::deque<std::function<void()>> m_jobs;
+    std::vector<std::thread> m_workers;
+    bool m_stopping = false;
+};
+
+std::unordered_set<Label*>& getLiveLabels() {
+    // never destroyed, labels can still be released by other static destructors at exit
+    static auto s_labels = new std::unordered_set<Label*>();
+    return *s_labels;
+}
+
+Label::~Label() {
+    getLiveLabels().erase(this);
+}
+
+void Label::reloadRuntimeFallbacks() {
+    for (auto label : getLiveLabels()) {
+        if (label->m_runtimeFallback) {
+            label->setRuntimeFallback(true, label->m_runtimeFontName);
+        }
+    }
+}
+
+void Label::collectMemoryStats(std::vector<memory::Usage>& out) {
+    memory::Usage labels{"labels"}, sprites{"glyph sprites"}, quads{"batch quad buffers"};
+
+    auto addBatch = [&](cocos2d::CCSpriteBatchNode* batch) {
+        if (!batch) {
+            return;
+        }
+
+        sprites.count += batch->getChildrenCount();
+        sprites.bytes += batch->getChildrenCount() * sizeof(cocos2d::CCSprite);
+
+        // every quad has 6 indices
+        auto capacity = batch->getTextureAtlas()->getCapacity();
+        quads.count += capacity;
+        quads.bytes += capacity * (sizeof(cocos2d::ccV3F_C4B_T2F_Quad) + 6 * sizeof(GLushort));
+    };
+
+    for (auto label : getLiveLabels()) {
+        ++labels.count;
+        labels.bytes += sizeof(Label)
+            + label->m_text.capacity()
+            + label->m_unicodeText.capacity() * sizeof(char32_t)
+            + label->m_shapedGlyphs.capacity() * sizeof(ShapedGlyph)
+            + label->m_sprites.capacity() * sizeof(cocos2d::CCSprite*)
+            + label->m_spriteChunks.capacity() * sizeof(size_t)
+            + label->m_layout.glyphs.capacity() * sizeof(PlacedGlyph);
+
+        addBatch(label->m_mainBatch.node);
+        addBatch(label->m_spriteSheetBatch.node);
+        addBatch(label->m_runtimeBatch.node);
+        for (auto& font : label->m_fontBatches) {
+            addBatch(font.batch.node);
+        }
+    }
+
+    out.push_back(std::move(labels));
+    out.push_back(std::move(sprites));
+    out.push_back(std::move(quads));
+}
+
 void Label::setString(std::string_view text) {
-    if (m_text == text) {
+    if (m_text == text && !m_useChunks) {
+        return;
+    }
+
+    std::u32string unicodeText;
+    std::vector<ShapedGlyph> glyphs;
+    if (!shapeText(text, unicodeText, glyphs)) {
         return;
     }
 
+    applyShapedText(text, std::move(unicodeText), std::move(glyphs));
+}
+
+void Label::setStrings(std::vector<std::pair<Label*, std::string_view>> const& labels) {
+    struct Shaped {
+        std::u32string text;
+        std::vector<ShapedGlyph> glyphs;
+        TextLayout layout;
+        bool valid = false;   // the text was decoded
+        bool laidOut = false; // the layout was computed by the worker
+    };
+
+    // the labels aren't modified until every worker is done, so they can be read from any thread
+    std::vector<Shaped> shaped(labels.size());
+    LayoutThreadPool::get().parallelFor(labels.size(), [&](size_t i) {
+        auto& [label, text] = labels[i];
+        auto& result = shaped[i];
+        if (label->m_text == text && !label->m_useChunks) {
+            return;
+        }
+
+        result.valid = label->shapeText(text, result.text, result.glyphs);
+
+        // chunks are only cleared when the text is applied, so those labels are laid out on the main thread
+        if (result.valid && !result.text.empty() && !label->m_useChunks) {
+            result.laidOut = label->m_useWrap
+                ? label->layoutTextWrapped(result.text, result.glyphs, false, result.layout)
+                : label->layoutText(result.text, result.glyphs, false, result.layout);
+        }
+    });
+
+    for (size_t i = 0; i < labels.size(); ++i) {
+        auto& [label, text] = labels[i];
+        auto& result = shaped[i];
+        if (result.laidOut) {
+            label->m_unicodeText = std::move(result.text);
+            label->m_shapedGlyphs = std::move(result.glyphs);
+            label->m_text = text;
+
+            label->hideAllChars();
+            std::swap(label->m_layout, result.layout);
+            label->applyLayout();
+        } else if (result.valid) {
+            label->applyShapedText(text, std::move(result.text), std::move(result.glyphs));
+        }
+    }
+}
+
+bool Label::shapeText(std::string_view text, std::u32string& outText, std::vector<ShapedGlyph>& outGlyphs) const {
+    outText.clear();
+    outGlyphs.clear();
     if (text.empty()) {
-        m_unicodeText.clear();
-        m_text.clear();
-    } else {
-        auto utf8TextRes = geode::utils::string::utf8ToUtf32(text);
-        if (utf8TextRes.isErr()) {
+        return true;
+    }
+
+    auto utf8TextRes = geode::utils::string::utf8ToUtf32(text);
+    if (utf8TextRes.isErr()) {
+        return false;
+    }
+
+    outText = std::move(utf8TextRes).unwrap();
+
+    // song titles often arrive decomposed (base letter + combining marks),
+    // compose them so they hit the precomposed glyphs in the fonts
+    unicode::normalizeNFC(outText);
+
+    outGlyphs.resize(outText.size());
+    for (size_t i = 0; i < outText.size(); ++i) {
+        if (outText[i] != '\n' && outText[i] != ' ') {
+            resolveGlyph(outText[i], 0, outGlyphs[i]);
+        }
+    }
+
+    return true;
+}
+
+void Label::applyShapedText(std::string_view text, std::u32string unicodeText, std::vector<ShapedGlyph> glyphs) {
+    m_chunks.clear();
+    m_chunkEnds.clear();
+    m_useChunks = false;
+
+    m_unicodeText = std::move(unicodeText);
+    m_shapedGlyphs = std::move(glyphs);
+    m_text = text;
+
+    updateChars();
+}
+
+void Label::setChunks(std::vector<Chunk> chunks) {
+    std::u32string unicodeText;
+    std::string text;
+    std::vector<size_t> chunkEnds;
+    chunkEnds.reserve(chunks.size());
+
+    for (auto& chunk : chunks) {
+        auto utf32Res = geode::utils::string::utf8ToUtf32(chunk.text);
+        if (utf32Res.isErr()) {
             return;
         }
 
-        m_unicodeText = std::move(utf8TextRes).unwrap();
-        m_text = text;
+        // normalize runs separately, so characters never get composed across a run boundary
+        auto chunkText = std::move(utf32Res).unwrap();
+        unicode::normalizeNFC(chunkText);
+
+        unicodeText += chunkText;
+        text += chunk.text;
+        chunkEnds.push_back(unicodeText.size());
     }
 
+    m_unicodeText = std::move(unicodeText);
+    m_shapedGlyphs.clear(); // glyphs are looked up per chunk font during layout
+    m_text = std::move(text);
+    m_chunks = std::move(chunks);
+    m_chunkEnds = std::move(chunkEnds);
+    m_useChunks = !m_chunks.empty();
+
     updateChars();
 }
 
@@ -433,6 +725,7 @@ void Label::setFont(std::string const& font) {
 
     m_fontConfig = newConfig;
     m_font = font;
+    m_shapedGlyphs.clear();
 
     m_mainBatch->setTexture(
         cocos2d::CCTextureCache::get()->addImage(
@@ -440,6 +733,13 @@ void Label::setFont(std::string const& font) {
         )
     );
 
+    updateBatchShader(m_mainBatch, m_fontConfig.get());
+
+    if (m_runtimeFallback) {
+        // the runtime glyphs are rasterized for the line height of the primary font (also lays out)
+        return setRuntimeFallback(true, m_runtimeFontName);
+    }
+
     updateChars();
 }
 
@@ -451,7 +751,7 @@ void Label::addFont(std::string const& font, std::optional<float> scale) {
 
     // check if the font is already added
     for (auto& cfg : m_fontBatches) {
-        if (cfg.config == newConfig) {
+        if (cfg.file == font) {
             return;
         }
     }
@@ -459,8 +759,11 @@ void Label::addFont(std::string const& font, std::optional<float> scale) {
     // add the font
     auto batch = cocos2d::CCSpriteBatchNode::create(newConfig->getAtlasName().c_str());
     batch->setID(fmt::format("font-batch-{}", m_fontBatches.size()));
-    m_fontBatches.push_back({newConfig, CachedBatch(batch), scale});
+    m_fontBatches.push_back({font, newConfig, CachedBatch(batch), scale});
+    m_shapedGlyphs.clear(); // the new font can have exact glyphs for aliased characters
     this->addChild(batch, 0, m_fontBatches.size());
+
+    updateBatchShader(m_fontBatches.back().batch, newConfig.get());
 }
 
 void Label::enableEmojis(std::string const& sheetFileName, const EmojiMap* frameNames) {
@@ -473,6 +776,7 @@ void Label::enableEmojis(std::string const& sheetFileName, const EmojiMap* frame
         this->addChild(m_spriteSheetBatch.node, 0, -1);
     }
     m_emojiMap = frameNames;
+    m_emojiTrie = frameNames ? &EmojiTrie::get(frameNames) : nullptr;
 }
 
 void Label::enableCustomNodes(const CustomNodeMap* nodes) {
@@ -532,6 +836,62 @@ void Label::limitLabelWidth(float width, float defaultScale, float minScale) {
     this->setScale(scale);
 }
 
+void Label::setMarquee(bool enabled, float width, float speed) {
+    m_useMarquee = enabled;
+    m_marqueeWidth = width;
+    m_marqueeSpeed = speed;
+    updateChars();
+}
+
+void Label::setOutline(cocos2d::ccColor4B const& color, float width) {
+    m_outlineColor = color;
+    m_outlineWidth = std::max(0.f, width);
+
+    updateBatchShader(m_mainBatch, m_fontConfig.get());
+    for (auto& [file, config, batch, scale] : m_fontBatches) {
+        updateBatchShader(batch, config.get());
+    }
+    updateBatchShader(m_runtimeBatch, m_runtimeFallback.get());
+
+    // glyph quads grow with the effect reach
+    updateChars();
+}
+
+void Label::setShadow(cocos2d::ccColor4B const& color, cocos2d::CCPoint const& offset) {
+    m_shadowColor = color;
+    m_shadowOffset = offset;
+
+    updateBatchShader(m_mainBatch, m_fontConfig.get());
+    for (auto& [file, config, batch, scale] : m_fontBatches) {
+        updateBatchShader(batch, config.get());
+    }
+    updateBatchShader(m_runtimeBatch, m_runtimeFallback.get());
+
+    updateChars();
+}
+
+void Label::setRuntimeFallback(bool enabled, std::string const& fontName) {
+    m_runtimeFontName = fontName;
+    m_runtimeFallback = enabled ? DynamicFontAtlas::get(fontName, m_fontConfig->getCommonHeight()) : nullptr;
+
+    if (m_runtimeFallback) {
+        if (m_runtimeBatch) {
+            // sprites keep their own reference to the texture, move them over so the old page is freed
+            m_runtimeBatch->setTexture(m_runtimeFallback->getTexture());
+            for (auto sprite : m_runtimeBatch.sprites) {
+                sprite->setTexture(m_runtimeFallback->getTexture());
+            }
+        } else {
+            m_runtimeBatch = cocos2d::CCSpriteBatchNode::createWithTexture(m_runtimeFallback->getTexture());
+            m_runtimeBatch->setID("runtime-batch");
+            this->addChild(m_runtimeBatch.node, 0, -2);
+        }
+        updateBatchShader(m_runtimeBatch, m_runtimeFallback.get());
+    }
+
+    updateChars();
+}
+
 void Label::addAllFonts() {
     this->addFont("font_cyrillic.fnt"_spr);
     this->addFont("font_default.fnt"_spr);
@@ -555,6 +915,8 @@ void Label::hideAllChars() {
         sprite->m_bVisible = false;
         sprite->m_bDirty = true;
     }
+    m_sprites.clear();
+    m_spriteChunks.clear();
 
     for (auto custom : m_customNodes) {
         custom->removeFromParent();
@@ -562,41 +924,44 @@ void Label::hideAllChars() {
     m_customNodes.clear();
 }
 
-void Label::updateAlignment() const {
-    if ((m_alignment == BMFontAlignment::Left || m_lines.size() < 2) && !m_useWrap) {
-        return;
+void Label::getLineAlignment(LineLayout const& layout, float contentWidth, float& outOffset, float& outGap) const {
+    outOffset = 0.f;
+    outGap = 0.f;
+
+    switch (m_alignment) {
+        case BMFontAlignment::Left:
+            break;
+        case BMFontAlignment::Center:
+            outOffset = (contentWidth - layout.width) * 0.5f;
+            break;
+        case BMFontAlignment::Right:
+            outOffset = contentWidth - layout.width;
+            break;
+        case BMFontAlignment::Justify:
+            // the last line of a paragraph is never stretched
+            if (layout.wrapped && layout.wordStarts.size() > 1) {
+                outGap = (contentWidth - layout.width) / static_cast<float>(layout.wordStarts.size() - 1);
+            }
+            break;
     }
+}
 
-    auto contentWidth = this->m_obContentSize.width;
-
-    for (auto& line : m_lines) {
-        if (line.empty()) {
-            continue;
+void Label::finalizeLine(
+    std::span<PlacedGlyph> line, LineLayout const& layout,
+    float offsetX, float offsetY, float gap
+) {
+    size_t word = 0;
+    float wordOffset = offsetX;
+    for (size_t i = 0; i < line.size(); ++i) {
+        if (gap != 0.f && word + 1 < layout.wordStarts.size() && i >= layout.wordStarts[word + 1]) {
+            ++word;
+            wordOffset = offsetX + gap * static_cast<float>(word);
         }
 
-        float offset = 0;
-        if (m_alignment == BMFontAlignment::Right) {
-            auto last = line.back();
-            offset = contentWidth - last->m_obPosition.x - last->m_obContentSize.width * last->m_fScaleX * 0.5f;
-        } else if (m_alignment == BMFontAlignment::Center) {
-            auto first = line.front();
-            auto last = line.back();
-            auto endPos = last->m_obPosition.x + last->m_obContentSize.width * last->m_fScaleX * 0.5f;
-            auto startPos = first->m_obPosition.x - first->m_obContentSize.width * first->m_fScaleX * 0.5f;
-            offset = (contentWidth - endPos + startPos) * 0.5f;
-        } else if (m_alignment == BMFontAlignment::Justify) {
-            // TODO: justify
-        }
-
-        if (offset == 0.f) {
-            continue;
-        }
-
-        for (auto& charSprite : line) {
-            charSprite->setPositionX(charSprite->m_obPosition.x + offset);
-        }
-    }
-}
+        line[i].position.x += wordOffset;
+        line[i].position.y += offsetY;
+    }
+}
 
 float Label::getWordWidth(std::vector<cocos2d::CCSprite*> const& word) {
     if (word.empty()) {
@@ -614,52 +979,176 @@ float Label::getWordWidth(std::vector<cocos2d::CCSprite*> const& word) {
     return lastPos - firstPos + lastSize * 0.5f + firstSize * 0.5f;
 }
 
-void Label::updateCharsWrapped() {
-    auto stringLen = m_unicodeText.size();
-    auto textSV = std::u32string_view(m_unicodeText);
+// how splitLatin1Words treats each Latin-1 character
+enum class Latin1Kind : uint8_t {
+    Plain,   // letters and numbers (AL, NU), which never allow a break between each other
+    Space,
+    Newline,
+    Other,   // anything else, checked against its neighbours with the pair table
+};
+
+static const auto LATIN1_KINDS = [] {
+    std::array<Latin1Kind, 0x100> kinds{};
+    for (char32_t c = 0; c < kinds.size(); ++c) {
+        auto cls = unicode::getLatin1LineBreakClass(c);
+        kinds[c] = c == ' ' ? Latin1Kind::Space
+            : c == '\n' ? Latin1Kind::Newline
+            : cls == unicode::LineBreakClass::AL || cls == unicode::LineBreakClass::NU ? Latin1Kind::Plain
+            : Latin1Kind::Other;
+    }
+    return kinds;
+}();
 
-    std::vector<std::vector<std::u32string_view>> lines;
+bool Label::splitLatin1Words(std::u32string_view text, int breakWords, std::vector<std::vector<WordSlice>>& outLines) {
+    auto stringLen = text.size();
+    auto firstLine = outLines.size();
     size_t wordStart = 0;
 
-    // split the text into lines and words
-    std::vector<std::u32string_view> words;
+    // latin words average about five letters, a guess that spares most of the regrowing
+    constexpr size_t LETTERS_PER_WORD = 4;
+    std::vector<WordSlice> words;
+    words.reserve(stringLen / LETTERS_PER_WORD + 1);
+
+    bool prevPlain = false;
     for (size_t i = 0; i < stringLen; ++i) {
-        if (textSV[i] == ' ') {
-            words.push_back(textSV.substr(wordStart, i - wordStart));
+        auto c = text[i];
+        if (c >= 0x100) {
+            outLines.resize(firstLine);
+            return false;
+        }
+
+        auto kind = LATIN1_KINDS[c];
+        if (kind == Latin1Kind::Plain && prevPlain) {
+            if (breakWords > 0 && i - wordStart >= static_cast<size_t>(breakWords)) {
+                words.push_back({text.substr(wordStart, i - wordStart)});
+                wordStart = i;
+            }
+            continue;
+        }
+
+        if (kind == Latin1Kind::Space) {
+            words.push_back({text.substr(wordStart, i - wordStart), true});
             wordStart = i + 1;
+            prevPlain = false;
             continue;
         }
 
-        // check if we should break the word
-        if (textSV[i] == '\n') {
-            words.push_back(textSV.substr(wordStart, i - wordStart));
+        if (kind == Latin1Kind::Newline) {
+            words.push_back({text.substr(wordStart, i - wordStart)});
             wordStart = i + 1;
-            lines.push_back(std::move(words));
-            words.clear();
-        } else if (i == stringLen - 1) {
-            words.push_back(textSV.substr(wordStart, i - wordStart + 1));
-            lines.push_back(std::move(words));
+            outLines.push_back(std::move(words));
+            words = {};
+            words.reserve((stringLen - wordStart) / LETTERS_PER_WORD + 1);
+            prevPlain = false;
+            continue;
+        }
+
+        if (i > wordStart) {
+            auto prevClass = unicode::getLatin1LineBreakClass(text[i - 1]);
+            if (unicode::isLineBreakAllowed(prevClass, unicode::getLatin1LineBreakClass(c))) {
+                words.push_back({text.substr(wordStart, i - wordStart)});
+                wordStart = i;
+            } else if (breakWords > 0 && i - wordStart >= static_cast<size_t>(breakWords)) {
+                words.push_back({text.substr(wordStart, i - wordStart)});
+                wordStart = i;
+            }
+        }
+        prevPlain = kind == Latin1Kind::Plain;
+    }
+    if (wordStart < stringLen) {
+        words.push_back({text.substr(wordStart)});
+    }
+    if (!words.empty()) {
+        outLines.push_back(std::move(words));
+    }
+    return true;
+}
+
+void Label::splitWords(std::u32string_view text, int breakWords, std::vector<std::vector<WordSlice>>& outLines) {
+    if (splitLatin1Words(text, breakWords, outLines)) {
+        return;
+    }
+
+    auto stringLen = text.size();
+    size_t wordStart = 0;
+
+    // split the text into lines and words, using UAX #14 break opportunities between non-space characters
+    std::vector<WordSlice> words;
+    auto prevClass = unicode::LineBreakClass::AL;
+    char32_t prevChar = 0;
+    bool hasPrev = false;
+    bool afterJoiner = false;
+    for (size_t i = 0; i < stringLen; ++i) {
+        auto c = text[i];
+        if (c == ' ') {
+            words.push_back({text.substr(wordStart, i - wordStart), true});
+            wordStart = i + 1;
+            hasPrev = false;
+            afterJoiner = false;
+            continue;
+        }
+
+        if (c == '\n') {
+            words.push_back({text.substr(wordStart, i - wordStart)});
+            wordStart = i + 1;
+            outLines.push_back(std::move(words));
             words.clear();
-        } else if (m_breakWords > 0 && i - wordStart >= m_breakWords) {
-            words.push_back(textSV.substr(wordStart, i - wordStart));
-            wordStart = i;
+            hasPrev = false;
+            afterJoiner = false;
+            continue;
         }
+
+        auto cls = unicode::getLineBreakClass(c);
+        if (cls == unicode::LineBreakClass::CM) {
+            // combining marks stay with their base character
+            if (hasPrev) {
+                afterJoiner = c == 0x200D;
+                continue;
+            }
+            cls = unicode::LineBreakClass::AL;
+        }
+
+        // never break inside zero width joiner sequences (LB8a)
+        if (hasPrev && i > wordStart && !afterJoiner) {
+            if (unicode::isLineBreakAllowed(prevClass, cls)) {
+                bool joined = unicode::isComplexContext(prevChar) || unicode::isComplexContext(c);
+                words.push_back({text.substr(wordStart, i - wordStart), false, joined});
+                wordStart = i;
+            } else if (breakWords > 0 && i - wordStart >= static_cast<size_t>(breakWords)) {
+                words.push_back({text.substr(wordStart, i - wordStart)});
+                wordStart = i;
+            }
+        }
+
+        prevClass = cls;
+        prevChar = c;
+        hasPrev = true;
+        afterJoiner = false;
+    }
+    if (wordStart < stringLen) {
+        words.push_back({text.substr(wordStart)});
     }
     if (!words.empty()) {
-        lines.push_back(std::move(words));
+        outLines.push_back(std::move(words));
     }
+}
 
-    m_lines.clear();
-    m_sprites.clear();
-    m_sprites.reserve(stringLen);
+bool Label::layoutTextWrapped(
+    std::u32string_view text, std::vector<ShapedGlyph> const& glyphs, bool mainThread, TextLayout& out
+) {
+    out.glyphs.clear();
+    out.glyphs.reserve(text.size());
+
+    std::vector<std::vector<WordSlice>> lines;
+    splitWords(text, m_breakWords, lines);
 
     auto& mainCharset = m_fontConfig->getFontDefDictionary();
     auto commonHeight = m_fontConfig->getCommonHeight();
     auto lineHeight = commonHeight + m_extraLineSpacing;
 
-    BMFontConfiguration* currentConfig = m_fontConfig;
+    BMFontConfiguration* currentConfig = m_fontConfig.get();
     const BMFontDef* fontDef = nullptr;
-    char32_t prevChar;
+    char32_t prevChar = -1;
     float kerningAmount = 0;
     float nextX = 0;
     float longestLine = 0;
@@ -668,28 +1157,35 @@ void Label::updateCharsWrapped() {
     auto& spaceDef = mainCharset.at(' ');
     auto spaceWidth = (m_extraKerning + spaceDef.xAdvance) / scaleFactor;
 
-    std::vector<size_t> indices(m_fontBatches.size() + 1, 0);
     size_t emojiIndex = 0;
 
     struct Word {
-        std::vector<CCNode*> sprites;
-        float xOffset = 0.f;
+        size_t begin = 0; // first placed glyph of the word
+        size_t end = 0;   // end of the word in the placed glyphs
         float fromX = 0;
         float toX = 0;
+        bool space = false;
+        bool joined = false;
     };
 
-    std::vector<std::vector<Word>> spriteLines;
-    std::vector<Word> currentSpriteLine;
-    Word currentSpriteWord;
+    std::vector<std::vector<Word>> wordLines;
+    wordLines.reserve(lines.size());
 
     // iterate over all words and get the width of each word
     for (auto& line : lines) {
+        auto& wordLine = wordLines.emplace_back();
+        wordLine.reserve(line.size());
+
         // build the words
-        for (auto& word : line) {
+        for (auto& [word, space, joined] : line) {
             auto wordLen = word.size();
             prevChar = -1;
 
-            currentSpriteWord.fromX = nextX;
+            auto& currentWord = wordLine.emplace_back();
+            currentWord.begin = out.glyphs.size();
+            currentWord.fromX = nextX;
+            currentWord.space = space;
+            currentWord.joined = joined;
 
             // iterate over all characters in the word
             for (uint32_t k = 0; k < wordLen; ++k) {
@@ -702,190 +1198,357 @@ void Label::updateCharsWrapped() {
                 // find the font definition for the character
                 float scale = 1.f;
                 size_t fontIndex = 0;
-                auto* currentBatch = &m_mainBatch;
+                currentConfig = m_fontConfig.get();
+                auto textIndex = word.data() - text.data() + k;
+                auto chunk = getChunkAt(textIndex);
+                float chunkScale = m_useChunks ? m_chunks[chunk].scale : 1.f;
 
                 if (m_spriteSheetBatch && shouldParseDigitRegionalIndicator(word.substr(k))) {
+                    if (!mainThread) {
+                        return false;
+                    }
                     checkForEmoji(
                         word, k, scaleFactor,
                         nextX, nextY, commonHeight,
-                        longestLine, currentSpriteWord.sprites,
+                        longestLine, out.glyphs,
                         emojiIndex
                     );
                     continue;
                 }
 
-                fontDef = getFontDefForChar(c, m_fontConfig, scale, fontIndex, currentBatch, currentConfig);
+                fontDef = getFontDefForChar(
+                    c, glyphs, textIndex, mainThread, scale, fontIndex, currentConfig,
+                    m_useChunks ? m_chunks[chunk].fontIndex : 0
+                );
                 if (!fontDef) {
+                    if (!mainThread) {
+                        // without emoji, runtime glyphs or released fonts, characters no font has are skipped
+                        if (m_spriteSheetBatch || m_runtimeFallback || hasReleasedFonts()) {
+                            return false;
+                        }
+                        continue;
+                    }
                     checkForEmoji(
                         word, k, scaleFactor,
                         nextX, nextY, commonHeight,
-                        longestLine, currentSpriteWord.sprites,
+                        longestLine, out.glyphs,
                         emojiIndex
                     );
                     continue;
                 }
+                scale *= chunkScale;
 
-                if (k == 0) {
-                    currentSpriteWord.xOffset = (m_extraKerning + fontDef->xOffset * scale) / scaleFactor;
-                }
-
-                auto& index = indices[fontIndex];
-                kerningAmount = kerningAmountForChars(prevChar, c, currentConfig) * scale;
-
-                Rect rect = {
-                    fontDef->rect.origin.x / scaleFactor, fontDef->rect.origin.y / scaleFactor,
-                    fontDef->rect.size.width / scaleFactor, fontDef->rect.size.height / scaleFactor
-                };
-
-                // Re-using existing sprites for performance reasons
-                auto fontChar = getSpriteForChar(*currentBatch, index, scale, rect);
-                currentSpriteWord.sprites.push_back(fontChar);
-                m_sprites.push_back(fontChar);
+                kerningAmount = kerningAmountForChars(prevChar, fontDef->charID, currentConfig) * scale;
 
-                rect.size.width *= scale;
-                rect.size.height *= scale;
+                // glyph rects of distance field fonts are in atlas texels, the metrics are already converted
+                float quadScale = scale * currentConfig->getTextureScale();
+                float yOffset = commonHeight * chunkScale - fontDef->yOffset * scale;
 
-                float yOffset = commonHeight - fontDef->yOffset * scale;
-
-                auto& pos = fontChar->m_obPosition;
-                pos.x = (
-                    nextX + fontDef->xOffset * scale + fontDef->rect.size.width * 0.5f * scale + kerningAmount
+                auto& glyph = out.glyphs.emplace_back();
+                glyph.def = fontDef;
+                glyph.fontIndex = fontIndex;
+                glyph.chunk = chunk;
+                glyph.quadScale = quadScale;
+                glyph.position.x = (
+                    nextX + fontDef->xOffset * scale + fontDef->rect.size.width * 0.5f * quadScale + kerningAmount
                 ) / scaleFactor;
-                pos.y = (
-                    nextY + yOffset - rect.size.height * 0.5f * scaleFactor
+                glyph.position.y = (
+                    nextY + yOffset - fontDef->rect.size.height * 0.5f * quadScale
                 ) / scaleFactor;
+                // transparent padding around the glyph doesn't count
+                glyph.left = glyph.position.x
+                    - (fontDef->rect.size.width * 0.5f - currentConfig->getPadding().left) * quadScale / scaleFactor;
 
                 // update kerning
                 auto advance = m_extraKerning + fontDef->xAdvance * scale + kerningAmount;
                 nextX += advance;
-                prevChar = c;
-
-                ++index;
+                prevChar = fontDef->charID; // aliased glyphs kern as their target
             }
 
-            currentSpriteWord.toX = nextX;
-
-            // add the word to the line
-            currentSpriteLine.push_back(std::move(currentSpriteWord));
-            currentSpriteWord.sprites.clear();
-            currentSpriteWord.xOffset = 0;
+            currentWord.end = out.glyphs.size();
+            currentWord.toX = nextX;
         }
-
-        // add the line to the lines
-        spriteLines.push_back(std::move(currentSpriteLine));
-        currentSpriteLine.clear();
     }
 
     // start wrapping the lines
-    std::vector<CCNode*> currentLine;
+    std::vector<LineLayout> lineLayouts;
+    LineLayout currentLayout;
+    float maxLineWidth = 0;
+    bool afterSpace = false; // the last word on the line is followed by a space
     nextX = 0;
     auto maxWidth = m_wrapWidth / getScale();
-    for (auto& spriteLine : spriteLines) {
-        for (auto& word : spriteLine) {
-            // auto wordWidth = getWordWidth(word.sprites);
+
+    auto wrapLine = [&](bool wrapped) {
+        currentLayout.wrapped = wrapped;
+        maxLineWidth = std::max(maxLineWidth, currentLayout.width);
+        auto lineEnd = currentLayout.end;
+        lineLayouts.push_back(std::move(currentLayout));
+        currentLayout = {};
+        currentLayout.begin = lineEnd;
+        currentLayout.end = lineEnd;
+        afterSpace = false;
+        nextX = 0;
+    };
+
+    for (auto& wordLine : wordLines) {
+        for (size_t w = 0; w < wordLine.size(); ++w) {
+            auto& word = wordLine[w];
             auto wordWidth = (word.toX - word.fromX) / scaleFactor;
-            // nextX += word.xOffset;
 
-            if (nextX + wordWidth > maxWidth) {
+            // words joined by fallback break opportunities (e.g. Thai) move to the next line as a group,
+            // and only get split if the group doesn't fit on a line by itself
+            if (word.joined && (w == 0 || !wordLine[w - 1].joined)) {
+                size_t groupEnd = w;
+                while (groupEnd + 1 < wordLine.size() && wordLine[groupEnd].joined) {
+                    ++groupEnd;
+                }
+
+                auto groupWidth = (wordLine[groupEnd].toX - word.fromX) / scaleFactor;
+                if (currentLayout.end > currentLayout.begin && nextX + groupWidth > maxWidth && groupWidth <= maxWidth) {
+                    wrapLine(true);
+                }
+            }
+
+            if (currentLayout.end > currentLayout.begin && nextX + wordWidth > maxWidth) {
                 // wrap the line
-                m_lines.push_back(std::move(currentLine));
-                currentLine.clear();
-                nextX = 0;
+                wrapLine(true);
             }
 
-            if (!word.sprites.empty()) {
+            if (word.end > word.begin) {
                 // add the word to the line
-                auto front = word.sprites.front();
-                float startX = front->m_obPosition.x - front->m_obContentSize.width * front->m_fScaleX * 0.5f;
-                for (auto& sprite : word.sprites) {
-                    sprite->m_obPosition.x += nextX - startX;
-                    currentLine.push_back(sprite);
+                float startX = out.glyphs[word.begin].left;
+                // justify only widens spaces, not breaks between ideographs or after hyphens
+                if (currentLayout.end == currentLayout.begin || afterSpace) {
+                    currentLayout.wordStarts.push_back(currentLayout.end - currentLayout.begin);
+                }
+                for (size_t i = word.begin; i < word.end; ++i) {
+                    out.glyphs[i].position.x += nextX - startX;
                 }
+                currentLayout.end = word.end;
                 nextX += wordWidth;
+                currentLayout.width = nextX;
+                afterSpace = false;
             }
 
             // append space
-            nextX += spaceWidth;
+            if (word.space) {
+                nextX += spaceWidth;
+                afterSpace = true;
+            }
         }
 
         // add the last line
-        m_lines.push_back(std::move(currentLine));
-        currentLine.clear();
-        nextX = 0;
+        wrapLine(false);
     }
 
-    // recalculate Y positions
-    float commonHeightScaled = (m_lines.size() <= 1 ? commonHeight : lineHeight) / scaleFactor;
-    float nextY = commonHeightScaled * m_lines.size() - commonHeightScaled;
-    float maxLineWidth = 0;
-    for (auto& line : m_lines) {
-        for (auto& sprite : line) {
-            sprite->m_obPosition.y += nextY;
-            maxLineWidth = std::max(maxLineWidth, sprite->m_obPosition.x + sprite->m_obContentSize.width * sprite->m_fScaleX);
-        }
+    // finalize the lines: alignment and Y positions are applied in the same pass
+    float commonHeightScaled = (lineLayouts.size() <= 1 ? commonHeight : lineHeight) / scaleFactor;
+    float nextY = commonHeightScaled * lineLayouts.size() - commonHeightScaled;
+    for (auto& layout : lineLayouts) {
+        float offset, gap;
+        getLineAlignment(layout, maxLineWidth, offset, gap);
+        finalizeLine(std::span(out.glyphs).subspan(layout.begin, layout.end - layout.begin), layout, offset, nextY, gap);
         nextY -= commonHeightScaled;
     }
 
-    /// == DEBUG ==
-    // for (auto& line : spriteLines) {
-    //     for (auto& word : line) {
-    //         // auto wordWidth = getWordWidth(word.sprites);
-    //         auto wordWidth = (word.toX - word.fromX) / scaleFactor;
-    //
-    //         auto startX = word.sprites.front()->getPositionX() - word.sprites.front()->getScaledContentSize().width * 0.5f;
-    //         auto startY = word.sprites.front()->getPositionY() - word.sprites.front()->getScaledContentSize().height * 0.5f;
-    //
-    //         auto spaceFiller = cocos2d::CCLayerColor::create({255, 0, 0, 100}, wordWidth, commonHeight / scaleFactor);
-    //         spaceFiller->setPosition(startX, startY);
-    //         this->addChild(spaceFiller, 100);
-    //     }
-    // }
-    /// ===========
-
-    this->setContentSize({maxLineWidth, lineHeight * m_lines.size() / scaleFactor});
-
-    this->updateAlignment();
+    out.size = {maxLineWidth, lineHeight * lineLayouts.size() / scaleFactor};
+    return true;
 }
 
-const BMFontDef* Label::getFontDefForChar(
-    char32_t c, const BMFontConfiguration* config, float& outScale, size_t& outIndex,
-    CachedBatch*& outBatch, BMFontConfiguration*& outConfig
-) {
-    auto& mainCharset = config->getFontDefDictionary();
+bool Label::resolveGlyph(char32_t c, size_t preferredFont, ShapedGlyph& outGlyph) const {
+    if (preferredFont > 0 && preferredFont <= m_fontBatches.size() && m_fontBatches[preferredFont - 1].config) {
+        auto& [file, config, batch, scale] = m_fontBatches[preferredFont - 1];
+        auto& charset = config->getFontDefDictionary();
+        auto it = charset.find(c);
+        if (it != charset.end() && it->second.charID == c) {
+            outGlyph.def = &it->second;
+            outGlyph.scale = scale.value_or(m_fontConfig->getCommonHeight() / config->getCommonHeight());
+            outGlyph.fontIndex = preferredFont;
+            return true;
+        }
+    }
+
+    auto& mainCharset = m_fontConfig->getFontDefDictionary();
     auto it = mainCharset.find(c);
-    if (it != mainCharset.end()) {
-        return &it->second;
+    if (it != mainCharset.end() && it->second.charID == c) {
+        outGlyph = {&it->second};
+        return true;
     }
 
-    // check for uppercase version of the character
-    auto upper = std::toupper(c);
-    it = mainCharset.find(upper);
+    // aliased glyph in the primary font, only used if no other font has the exact glyph
     if (it != mainCharset.end()) {
-        return &it->second;
+        outGlyph = {&it->second};
     }
 
     // check other fonts
     for (size_t i = 0; i < m_fontBatches.size(); ++i) {
-        auto& [config, batch, scale] = m_fontBatches[i];
+        auto& [file, config, batch, scale] = m_fontBatches[i];
+        if (!config) {
+            continue; // released, and the text didn't need it when it was shaped
+        }
+
         auto& charset = config->getFontDefDictionary();
         it = charset.find(c);
-        if (it != charset.end()) {
-            outIndex = i + 1;
-            if (scale.has_value()) {
-                // manual font scale
-                outScale = scale.value();
-            } else {
-                // auto calculated scale
-                outScale = m_fontConfig->getCommonHeight() / config->getCommonHeight();
+        if (it == charset.end() || (outGlyph.def && it->second.charID != c)) {
+            continue;
+        }
+
+        outGlyph.def = &it->second;
+        // manual font scale, or auto calculated from the line heights
+        outGlyph.scale = scale.value_or(m_fontConfig->getCommonHeight() / config->getCommonHeight());
+        outGlyph.fontIndex = i + 1;
+
+        if (it->second.charID == c) {
+            return true;
+        }
+
+        // keep looking for an exact glyph, but remember the first alias
+    }
+
+    return outGlyph.def != nullptr;
+}
+
+const BMFontDef* Label::getFontDefForChar(
+    char32_t c, std::vector<ShapedGlyph> const& glyphs, size_t textIndex, bool mainThread,
+    float& outScale, size_t& outIndex, BMFontConfiguration*& outConfig, size_t preferredFont
+) {
+    if (mainThread && preferredFont > 0 && preferredFont <= m_fontBatches.size()) {
+        acquireFont(preferredFont - 1);
+    }
+
+    ShapedGlyph glyph;
+    bool found = false;
+    if (textIndex < glyphs.size() && glyphs[textIndex].def) {
+        // looked up when the text was shaped
+        glyph = glyphs[textIndex];
+        found = true;
+    } else {
+        found = resolveGlyph(c, preferredFont, glyph);
+    }
+
+    // a released font can have the exact glyph, they're loaded again one at a time until it's found
+    if ((!found || glyph.def->charID != c) && hasReleasedFonts()) {
+        if (!mainThread) {
+            return nullptr;
+        }
+
+        for (size_t i = 0; i < m_fontBatches.size(); ++i) {
+            if (m_fontBatches[i].config || !acquireFont(i)) {
+                continue;
+            }
+
+            glyph = {};
+            found = resolveGlyph(c, preferredFont, glyph);
+            if (found && glyph.def->charID == c) {
+                break;
             }
-            outIndex = i + 1;
-            outBatch = &batch;
-            outConfig = config;
-            return &it->second;
         }
     }
 
-    return nullptr;
+    if (!found) {
+        return mainThread ? getRuntimeFontDef(c, outScale, outIndex, outConfig) : nullptr;
+    }
+
+    if (glyph.fontIndex > 0) {
+        outScale = glyph.scale;
+        outIndex = glyph.fontIndex;
+        outConfig = m_fontBatches[glyph.fontIndex - 1].config.get();
+    }
+
+    return glyph.def;
+}
+
+const BMFontDef* Label::getRuntimeFontDef(
+    char32_t c, float& outScale, size_t& outIndex, BMFontConfiguration*& outConfig
+) {
+    if (!m_runtimeFallback) {
+        return nullptr;
+    }
+
+    // leave control characters, joiners, selectors and anything starting an emoji to checkForEmoji
+    if (c < 0x20 || c == 0x200C || isZeroWidthJoiner(c) || isVariationSelector(c)
+        || isSkinToneModifier(c) || isRegionalIndicator(c) || (c >= 0xE0000 && c <= 0xE007F)
+        || (m_emojiTrie && m_emojiTrie->startsSequence(c))
+    ) {
+        return nullptr;
+    }
+
+    auto def = m_runtimeFallback->getGlyph(c);
+    if (!def) {
+        return nullptr;
+    }
+
+    outScale = m_fontConfig->getCommonHeight() / m_runtimeFallback->getCommonHeight();
+    outIndex = m_fontBatches.size() + 1;
+    outConfig = m_runtimeFallback.get();
+    return def;
+}
+
+bool Label::acquireFont(size_t index) {
+    auto& [file, config, batch, scale] = m_fontBatches[index];
+    if (config) {
+        return true;
+    }
+
+    config = BMFontConfiguration::create(file);
+    if (!config) {
+        return false; // glyph lookups skip the font
+    }
+
+    // the atlas was reloaded if the font was evicted or the font cache was purged
+    batch->setTexture(cocos2d::CCTextureCache::get()->addImage(config->getAtlasName().c_str(), false));
+    updateBatchShader(batch, config.get());
+    return true;
+}
+
+bool Label::hasReleasedFonts() const {
+    return std::ranges::any_of(m_fontBatches, [](FontCfg const& font) { return !font.config; });
+}
+
+void Label::releaseUnusedFonts(std::vector<size_t> const& glyphCounts) {
+    bool released = false;
+    for (size_t i = 0; i < m_fontBatches.size(); ++i) {
+        auto& font = m_fontBatches[i];
+        if (!font.config || (i + 1 < glyphCounts.size() && glyphCounts[i + 1] > 0)) {
+            continue;
+        }
+
+        font.config.reset();
+        font.batch.config = nullptr;
+        released = true;
+
+        // the sprites and the batch hold the atlas, it can only be freed if the font gets evicted without them
+        font.batch->removeAllChildrenWithCleanup(true);
+        font.batch.sprites.clear();
+        font.batch->setTexture(m_mainBatch->getTexture());
+
+        // a reacquired configuration can be a different object
+        for (auto& glyph : m_shapedGlyphs) {
+            if (glyph.fontIndex == i + 1) {
+                glyph = {};
+            }
+        }
+    }
+
+    if (released) {
+        BMFontConfiguration::trimCache();
+    }
+}
+
+size_t Label::getChunkAt(size_t index) const {
+    if (!m_useChunks) {
+        return 0;
+    }
+
+    auto it = std::upper_bound(m_chunkEnds.begin(), m_chunkEnds.end(), index);
+    return std::min<size_t>(it - m_chunkEnds.begin(), m_chunks.size() - 1);
+}
+
+void Label::addSprite(cocos2d::CCSprite* sprite, size_t chunk) {
+    m_sprites.push_back(sprite);
+    if (m_useChunks) {
+        m_spriteChunks.push_back(chunk);
+    }
 }
 
 std::u32string_view Label::parseEmoji(std::u32string_view text, uint32_t& index) const {
@@ -930,20 +1593,22 @@ std::u32string_view Label::parseEmoji(std::u32string_view text, uint32_t& index)
 
 void Label::checkForEmoji(
     std::u32string_view text, uint32_t& index, float scaleFactor, float& nextX, float nextY, float commonHeight,
-    float& longestLine, std::vector<CCNode*>& currentLine, size_t& emojiIndex
+    float& longestLine, std::vector<PlacedGlyph>& outGlyphs, size_t& emojiIndex
 ) {
     if (!m_spriteSheetBatch) {
         return;
     }
 
-    auto decodedEmoji = parseEmoji(text, index);
-    auto emojiIt = m_emojiMap->find(decodedEmoji);
-    if (emojiIt != m_emojiMap->end()) {
+    size_t emojiLength = 0;
+    auto frameName = m_emojiTrie ? m_emojiTrie->match(text.substr(index), emojiLength) : nullptr;
+    if (frameName) {
+        index += emojiLength - 1; // move to the last codepoint of the sequence
+
         auto sprite = m_spriteSheetBatch[emojiIndex];
         if (!sprite) {
             // create new sprite
-            sprite = cocos2d::CCSprite::createWithSpriteFrameName(emojiIt->second);
-            if (!sprite) { return geode::log::warn("Frame {} was not found (create)", emojiIt->second); }
+            sprite = cocos2d::CCSprite::createWithSpriteFrameName(frameName);
+            if (!sprite) { return geode::log::warn("Frame {} was not found (create)", frameName); }
             m_spriteSheetBatch.addChild(sprite, emojiIndex, emojiIndex);
 
             // modify opacity and color
@@ -952,10 +1617,14 @@ void Label::checkForEmoji(
             }
             sprite->setOpacity(m_opacity);
         } else {
-            auto spriteFrame = cocos2d::CCSpriteFrameCache::get()->spriteFrameByName(emojiIt->second);
-            if (!spriteFrame) { return geode::log::warn("Frame {} was not found (update)", emojiIt->second); }
+            auto spriteFrame = cocos2d::CCSpriteFrameCache::get()->spriteFrameByName(frameName);
+            if (!spriteFrame) { return geode::log::warn("Frame {} was not found (update)", frameName); }
             sprite->m_bVisible = true;
             sprite->setDisplayFrame(spriteFrame);
+
+            // same as a new sprite, chunk colors are applied after layout
+            sprite->setColor(m_useEmojiColors ? m_color : cocos2d::ccc3(255, 255, 255));
+            sprite->setOpacity(m_opacity);
         }
 
         // calculate size
@@ -970,11 +1639,14 @@ void Label::checkForEmoji(
         sprite->setScale(sprScale);
         sizeInPixels.width *= sprScale;
 
-        // update position
-        sprite->setPosition({
+        // final position is set when the line is finalized
+        auto& placed = outGlyphs.emplace_back();
+        placed.node = sprite;
+        placed.position = {
             (nextX + sizeInPixels.width * .5f) / scaleFactor,
             (nextY + commonHeight * .5f) / scaleFactor
-        });
+        };
+        placed.left = nextX / scaleFactor;
         nextX += sizeInPixels.width + m_extraKerning;
 
         // update longest line
@@ -982,10 +1654,11 @@ void Label::checkForEmoji(
             longestLine = nextX;
         }
 
-        currentLine.push_back(sprite);
-        m_sprites.push_back(sprite);
+        // text is always a view into m_unicodeText (the whole text or a single word)
+        addSprite(sprite, getChunkAt(text.data() - m_unicodeText.data() + index));
         ++emojiIndex;
     } else if (m_customNodeMap) {
+        auto decodedEmoji = parseEmoji(text, index);
         auto it = m_customNodeMap->find(decodedEmoji);
         if (it == m_customNodeMap->end()) { return; }
 
@@ -1004,11 +1677,14 @@ void Label::checkForEmoji(
         node->setScale(sprScale);
         sizeInPixels.width *= sprScale;
 
-        // update position
-        node->setPosition({
+        // final position is set when the line is finalized
+        auto& placed = outGlyphs.emplace_back();
+        placed.node = node;
+        placed.position = {
             (nextX + sizeInPixels.width * .5f) / scaleFactor,
             (nextY + commonHeight * .5f) / scaleFactor
-        });
+        };
+        placed.left = nextX / scaleFactor;
         nextX += sizeInPixels.width + m_extraKerning;
 
         // update longest line
@@ -1017,33 +1693,432 @@ void Label::checkForEmoji(
         }
 
         this->addChild(node, 0, m_customNodes.size());
-        currentLine.push_back(node);
         m_customNodes.push_back(node);
     }
 }
 
+// gap between the end of the text and its repeated start
+constexpr float MARQUEE_GAP = 24.f;
+// time the text stays still at the start of every loop
+constexpr float MARQUEE_HOLD = 2.f;
+
+void Label::updateMarquee() {
+    m_textWidth = m_obContentSize.width;
+
+    bool active = m_useMarquee && !m_useWrap && m_marqueeWidth > 0.f && m_textWidth > m_marqueeWidth;
+    if (active != m_marqueeActive) {
+        m_marqueeActive = active;
+        if (active) {
+            this->scheduleUpdate();
+        } else {
+            this->unscheduleUpdate();
+        }
+    }
+
+    // always start over when the text changes
+    m_marqueeOffset = 0.f;
+    m_marqueeHold = MARQUEE_HOLD;
+
+    if (active) {
+        this->setContentSize({m_marqueeWidth, m_obContentSize.height});
+    }
+}
+
+void Label::update(float dt) {
+    if (!m_marqueeActive) {
+        return;
+    }
+
+    if (m_marqueeHold > 0.f) {
+        m_marqueeHold -= dt;
+        return;
+    }
+
+    // once the repeated start reaches the left edge, the label looks exactly like before
+    m_marqueeOffset += m_marqueeSpeed * dt;
+    if (m_marqueeOffset >= m_textWidth + MARQUEE_GAP) {
+        m_marqueeOffset = 0.f;
+        m_marqueeHold = MARQUEE_HOLD;
+    }
+}
+
+void Label::visit() {
+    bool effects = hasCustomShaders();
+    if (!m_marqueeActive && !effects) {
+        return CCNode::visit();
+    }
+
+    if (!m_bVisible) {
+        return;
+    }
+
+    kmGLPushMatrix();
+    this->transform();
+
+    if (!m_marqueeActive) {
+        this->sortAllChildren();
+        for (auto child : geode::cocos::CCArrayExt<CCNode*>(m_pChildren)) {
+            if (auto batch = getFontBatch(child)) {
+                setBatchUniforms(*batch);
+            }
+            child->visit();
+        }
+
+        return kmGLPopMatrix();
+    }
+
+    // clip to the visible part of the label
+    auto bottomLeft = this->convertToWorldSpace({0.f, 0.f});
+    auto topRight = this->convertToWorldSpace({m_obContentSize.width, m_obContentSize.height});
+    cocos2d::CCRect clip = {
+        std::min(bottomLeft.x, topRight.x), std::min(bottomLeft.y, topRight.y),
+        std::abs(topRight.x - bottomLeft.x), std::abs(topRight.y - bottomLeft.y)
+    };
+
+    auto glView = cocos2d::CCEGLView::get();
+    bool hadScissor = glView->isScissorEnabled();
+    cocos2d::CCRect previousClip;
+    if (hadScissor) {
+        // intersect with the clip of a parent
+        previousClip = glView->getScissorRect();
+        auto minX = std::max(clip.getMinX(), previousClip.getMinX());
+        auto minY = std::max(clip.getMinY(), previousClip.getMinY());
+        auto maxX = std::min(clip.getMaxX(), previousClip.getMaxX());
+        auto maxY = std::min(clip.getMaxY(), previousClip.getMaxY());
+        clip = {minX, minY, std::max(0.f, maxX - minX), std::max(0.f, maxY - minY)};
+    } else {
+        glEnable(GL_SCISSOR_TEST);
+    }
+    glView->setScissorInPoints(clip.origin.x, clip.origin.y, clip.size.width, clip.size.height);
+
+    // draw the text, and its repeated start once the end scrolls into view
+    this->sortAllChildren();
+    float offsets[2] = {-m_marqueeOffset, m_textWidth + MARQUEE_GAP - m_marqueeOffset};
+    for (auto offset : offsets) {
+        if (offset >= m_obContentSize.width) {
+            break;
+        }
+
+        kmGLPushMatrix();
+        kmGLTranslatef(offset, 0.f, 0.f);
+        for (auto child : geode::cocos::CCArrayExt<CCNode*>(m_pChildren)) {
+            if (auto batch = effects ? getFontBatch(child) : nullptr) {
+                setBatchUniforms(*batch);
+            }
+            child->visit();
+        }
+        kmGLPopMatrix();
+    }
+
+    if (hadScissor) {
+        glView->setScissorInPoints(
+            previousClip.origin.x, previousClip.origin.y,
+            previousClip.size.width, previousClip.size.height
+        );
+    } else {
+        glDisable(GL_SCISSOR_TEST);
+    }
+
+    kmGLPopMatrix();
+}
+
+struct LabelShaderProgram {
+    cocos2d::CCGLProgram* program = nullptr;
+    GLint texelSize = -1;
+    GLint outlineColor = -1;
+    GLint outlineWidth = -1;
+    GLint shadowColor = -1;
+    GLint shadowOffset = -1;
+    GLint smoothing = -1;
+};
+
+// outline and shadow are found by sampling the atlas alpha around each texel.
+// output stays premultiplied, like the regular sprite shader
+constexpr auto LABEL_EFFECT_FRAG = R"(
+#ifdef GL_ES
+precision mediump float;
+#endif
+
+varying vec4 v_fragmentColor;
+varying vec2 v_texCoord;
+uniform sampler2D CC_Texture0;
+
+uniform vec2 u_texelSize;
+uniform vec4 u_outlineColor;
+uniform float u_outlineWidth;
+uniform vec4 u_shadowColor;
+uniform vec2 u_shadowOffset;
+
+void main() {
+    vec4 glyph = texture2D(CC_Texture0, v_texCoord) * v_fragmentColor;
+
+    float outline = 0.0;
+    if (u_outlineWidth > 0.0) {
+        vec2 d = u_texelSize * u_outlineWidth;
+        vec2 e = d * 0.7071;
+        outline = max(outline, texture2D(CC_Texture0, v_texCoord + vec2(d.x, 0.0)).a);
+        outline = max(outline, texture2D(CC_Texture0, v_texCoord - vec2(d.x, 0.0)).a);
+        outline = max(outline, texture2D(CC_Texture0, v_texCoord + vec2(0.0, d.y)).a);
+        outline = max(outline, texture2D(CC_Texture0, v_texCoord - vec2(0.0, d.y)).a);
+        outline = max(outline, texture2D(CC_Texture0, v_texCoord + e).a);
+        outline = max(outline, texture2D(CC_Texture0, v_texCoord - e).a);
+        outline = max(outline, texture2D(CC_Texture0, v_texCoord + vec2(e.x, -e.y)).a);
+        outline = max(outline, texture2D(CC_Texture0, v_texCoord + vec2(-e.x, e.y)).a);
+    }
+
+    float shadow = texture2D(CC_Texture0, v_texCoord - u_shadowOffset * u_texelSize).a;
+
+    float shadowAlpha = shadow * u_shadowColor.a * v_fragmentColor.a;
+    float outlineAlpha = outline * u_outlineColor.a * v_fragmentColor.a;
+    vec4 color = vec4(u_shadowColor.rgb, 1.0) * shadowAlpha;
+    color = vec4(u_outlineColor.rgb, 1.0) * outlineAlpha + color * (1.0 - outlineAlpha);
+    gl_FragColor = glyph + color * (1.0 - glyph.a);
+}
+)";
+
+// distance field atlases store 0.5 at the glyph edge. the edge is antialiased over one screen pixel
+// (u_smoothing), and the outline and shadow are just lower thresholds of the same field
+constexpr auto LABEL_SDF_FRAG = R"(
+#ifdef GL_ES
+precision mediump float;
+#endif
+
+varying vec4 v_fragmentColor;
+varying vec2 v_texCoord;
+uniform sampler2D CC_Texture0;
+
+uniform vec2 u_texelSize;
+uniform vec4 u_outlineColor;
+uniform float u_outlineWidth;
+uniform vec4 u_shadowColor;
+uniform vec2 u_shadowOffset;
+uniform float u_smoothing;
+
+void main() {
+    float dist = texture2D(CC_Texture0, v_texCoord).a;
+    float shadowDist = texture2D(CC_Texture0, v_texCoord - u_shadowOffset * u_texelSize).a;
+    float edge = 0.5 - u_outlineWidth;
+
+    vec4 glyph = v_fragmentColor * smoothstep(0.5 - u_smoothing, 0.5 + u_smoothing, dist);
+    float outline = smoothstep(edge - u_smoothing, edge + u_smoothing, dist);
+    float shadow = smoothstep(edge - u_smoothing, edge + u_smoothing, shadowDist);
+
+    float shadowAlpha = shadow * u_shadowColor.a * v_fragmentColor.a;
+    float outlineAlpha = outline * u_outlineColor.a * v_fragmentColor.a;
+    vec4 color = vec4(u_shadowColor.rgb, 1.0) * shadowAlpha;
+    color = vec4(u_outlineColor.rgb, 1.0) * outlineAlpha + color * (1.0 - outlineAlpha);
+    gl_FragColor = glyph + color * (1.0 - glyph.a);
+}
+)";
+
+static LabelShaderProgram const& getLabelShaderProgram(bool distanceField) {
+    static LabelShaderProgram s_effect, s_distanceField;
+    auto& shader = distanceField ? s_distanceField : s_effect;
+
+    // the shader cache is reloaded with the rest of the graphics, so check the program is still the cached one
+    auto key = distanceField ? GEODE_MOD_ID "/label-sdf" : GEODE_MOD_ID "/label-effect";
+    auto cache = cocos2d::CCShaderCache::sharedShaderCache();
+    auto program = cache->programForKey(key);
+    if (program && program == shader.program) {
+        return shader;
+    }
+
+    if (!program) {
+        program = new cocos2d::CCGLProgram();
+        program->initWithVertexShaderByteArray(
+            cocos2d::ccPositionTextureColor_vert,
+            distanceField ? LABEL_SDF_FRAG : LABEL_EFFECT_FRAG
+        );
+        program->addAttribute(kCCAttributeNamePosition, cocos2d::kCCVertexAttrib_Position);
+        program->addAttribute(kCCAttributeNameColor, cocos2d::kCCVertexAttrib_Color);
+        program->addAttribute(kCCAttributeNameTexCoord, cocos2d::kCCVertexAttrib_TexCoords);
+        program->link();
+        program->updateUniforms();
+        cache->addProgram(program, key);
+        program->release();
+    }
+
+    shader.program = program;
+    shader.texelSize = program->getUniformLocationForName("u_texelSize");
+    shader.outlineColor = program->getUniformLocationForName("u_outlineColor");
+    shader.outlineWidth = program->getUniformLocationForName("u_outlineWidth");
+    shader.shadowColor = program->getUniformLocationForName("u_shadowColor");
+    shader.shadowOffset = program->getUniformLocationForName("u_shadowOffset");
+    shader.smoothing = program->getUniformLocationForName("u_smoothing");
+    return shader;
+}
+
+bool Label::hasTextEffects() const {
+    return m_outlineWidth > 0.f || m_shadowColor.a > 0;
+}
+
+bool Label::hasCustomShaders() const {
+    if (hasTextEffects() || (m_fontConfig && m_fontConfig->isDistanceField())) {
+        return true;
+    }
+
+    for (auto& cfg : m_fontBatches) {
+        if (cfg.config && cfg.config->isDistanceField()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Label::updateBatchShader(CachedBatch& batch, const BMFontConfiguration* config) const {
+    if (!batch || !config) {
+        return;
+    }
+
+    batch.config = config;
+
+    if (config->isDistanceField()) {
+        // the field falloff is the reach, it's already part of the glyph rects
+        batch.effectReach = config->getDistanceRange() * 0.5f * config->getTextureScale();
+        batch.effectMargin = 0.f;
+        batch->setShaderProgram(getLabelShaderProgram(true).program);
+        return;
+    }
+
+    if (!hasTextEffects()) {
+        batch.effectReach = 0.f;
+        batch.effectMargin = 0.f;
+        batch->setShaderProgram(
+            cocos2d::CCShaderCache::sharedShaderCache()->programForKey(kCCShader_PositionTextureColor)
+        );
+        return;
+    }
+
+    auto scaleFactor = cocos2d::CCDirector::get()->getContentScaleFactor();
+    auto shadowReach = m_shadowColor.a > 0 ? std::max(std::abs(m_shadowOffset.x), std::abs(m_shadowOffset.y)) : 0.f;
+    auto wantedReach = std::max(m_outlineWidth, shadowReach) * scaleFactor;
+
+    // transparent padding inside the glyph rect already gives the effects some room
+    auto& padding = config->getPadding();
+    auto minPadding = std::min({padding.left, padding.top, padding.right, padding.bottom});
+
+    batch.effectReach = std::min(wantedReach, config->getEffectReach());
+    batch.effectMargin = std::max(0.f, batch.effectReach - minPadding);
+    batch->setShaderProgram(getLabelShaderProgram(false).program);
+}
+
+void Label::setBatchUniforms(CachedBatch const& batch) {
+    auto config = batch.config;
+    auto texture = batch->getTexture();
+    if (!config || !texture || (!config->isDistanceField() && !hasTextEffects())) {
+        return;
+    }
+
+    auto& shader = getLabelShaderProgram(config->isDistanceField());
+
+    // effect sizes in atlas texels
+    auto scaleFactor = cocos2d::CCDirector::get()->getContentScaleFactor();
+    auto textureScale = config->getTextureScale();
+    auto reach = batch.effectReach;
+    auto outlineWidth = std::min(m_outlineWidth * scaleFactor, reach) / textureScale;
+    auto shadowX = std::clamp(m_shadowOffset.x * scaleFactor, -reach, reach) / textureScale;
+    auto shadowY = std::clamp(m_shadowOffset.y * scaleFactor, -reach, reach) / textureScale;
+
+    // uniforms are per program, so every batch sets its own values right before drawing
+    shader.program->use();
+
+    if (config->isDistanceField()) {
+        // one screen pixel in distance units at the current node scale (font scales are not included)
+        auto origin = this->convertToWorldSpace({0.f, 0.f});
+        auto unit = this->convertToWorldSpace({1.f, 0.f});
+        auto pixelsPerPoint = std::hypot(unit.x - origin.x, unit.y - origin.y)
+            * cocos2d::CCEGLView::get()->getScaleX();
+        auto pixelsPerTexel = pixelsPerPoint / config->getAtlasScale();
+        auto range = config->getDistanceRange();
+
+        shader.program->setUniformLocationWith1f(
+            shader.smoothing,
+            std::clamp(0.5f / (pixelsPerTexel * range), 0.01f, 0.5f)
+        );
+        outlineWidth /= range;
+    }
+
+    shader.program->setUniformLocationWith2f(
+        shader.texelSize,
+        1.f / static_cast<float>(texture->getPixelsWide()),
+        1.f / static_cast<float>(texture->getPixelsHigh())
+    );
+    // the distance field shader always draws the outline threshold, so hide it when disabled
+    shader.program->setUniformLocationWith4f(
+        shader.outlineColor,
+        m_outlineColor.r / 255.f, m_outlineColor.g / 255.f, m_outlineColor.b / 255.f,
+        m_outlineWidth > 0.f ? m_outlineColor.a / 255.f : 0.f
+    );
+    shader.program->setUniformLocationWith1f(shader.outlineWidth, outlineWidth);
+    shader.program->setUniformLocationWith4f(
+        shader.shadowColor,
+        m_shadowColor.r / 255.f, m_shadowColor.g / 255.f, m_shadowColor.b / 255.f, m_shadowColor.a / 255.f
+    );
+    // texture coordinates are flipped vertically
+    shader.program->setUniformLocationWith2f(shader.shadowOffset, shadowX, -shadowY);
+}
+
+const Label::CachedBatch* Label::getFontBatch(CCNode* batchNode) const {
+    if (!batchNode) {
+        return nullptr;
+    }
+
+    if (batchNode == m_mainBatch.node) {
+        return &m_mainBatch;
+    }
+
+    for (auto& cfg : m_fontBatches) {
+        if (batchNode == cfg.batch.node) {
+            return &cfg.batch;
+        }
+    }
+
+    if (batchNode == m_runtimeBatch.node) {
+        return &m_runtimeBatch;
+    }
+
+    return nullptr;
+}
+
 cocos2d::CCSprite* Label::getSpriteForChar(
     CachedBatch& batch, size_t index, float scale, cocos2d::CCRect const& rect
 ) const {
+    // grow the quad so outlines and shadows have room around the glyph
+    auto quad = rect;
+    if (batch.effectMargin > 0.f) {
+        auto margin = batch.effectMargin / cocos2d::CCDirector::get()->getContentScaleFactor();
+        quad = {
+            rect.origin.x - margin, rect.origin.y - margin,
+            rect.size.width + margin * 2.f, rect.size.height + margin * 2.f
+        };
+    }
+
     auto fontChar = batch[index];
     if (!fontChar) {
         fontChar = new cocos2d::CCSprite();
 
-        fontChar->initWithTexture(batch->getTexture(), rect);
+        fontChar->initWithTexture(batch->getTexture(), quad);
         fontChar->setScale(scale);
         batch.addChild(fontChar, index, index);
         fontChar->release();
 
         // Apply label properties
-        fontChar->setOpacityModifyRGB(m_isOpacityModifyRGB);
+        // the runtime atlas isn't premultiplied, so its sprites must not darken with opacity
+        fontChar->setOpacityModifyRGB(m_isOpacityModifyRGB && batch->getTexture()->hasPremultipliedAlpha());
 
         // Color MUST be set before opacity, since opacity might change color if OpacityModifyRGB is on
         fontChar->setColor(m_color);
         fontChar->setOpacity(m_opacity);
     } else {
-        // reusing existing sprite
+        // reusing existing sprite, the scale can differ between chunks
         fontChar->m_bVisible = true;
-        fontChar->setTextureRect(rect, false, rect.size);
+        fontChar->setTextureRect(quad, false, quad.size);
+        fontChar->setScale(scale);
+
+        // it can still have a chunk color, or miss opacity changes made while it was hidden
+        fontChar->setColor(m_color);
+        fontChar->setOpacity(m_opacity);
     }
     return fontChar;
 }
@@ -1051,38 +2126,40 @@ cocos2d::CCSprite* Label::getSpriteForChar(
 void Label::updateChars() {
     hideAllChars();
 
-    //      if (m_useChunks) {
-    //          return updateChunkedChars();
-    //      }
-
     if (m_unicodeText.empty()) {
-        return this->setContentSize({0.f, 0.f});
+        releaseUnusedFonts({});
+        this->setContentSize({0.f, 0.f});
+        return this->updateMarquee();
     }
 
     if (m_useWrap) {
-        return updateCharsWrapped();
+        layoutTextWrapped(m_unicodeText, m_shapedGlyphs, true, m_layout);
+    } else {
+        layoutText(m_unicodeText, m_shapedGlyphs, true, m_layout);
     }
 
-    auto stringLen = m_unicodeText.size();
+    applyLayout();
+}
+
+bool Label::layoutText(
+    std::u32string_view text, std::vector<ShapedGlyph> const& glyphs, bool mainThread, TextLayout& out
+) {
+    auto stringLen = text.size();
+    out.glyphs.clear();
+    out.glyphs.reserve(stringLen);
 
     // Calculate the number of lines
     uint32_t lines = 1;
     for (uint32_t i = 0; i < stringLen; ++i) {
-        if (m_unicodeText[i] == '\n') {
+        if (text[i] == '\n') {
             ++lines;
         }
     }
 
-    m_lines.clear();
-    m_lines.reserve(lines);
-
-    m_sprites.clear();
-    m_sprites.reserve(stringLen);
-
     auto commonHeight = m_fontConfig->getCommonHeight();
     auto lineHeight = commonHeight + m_extraLineSpacing;
 
-    BMFontConfiguration* currentConfig = m_fontConfig;
+    BMFontConfiguration* currentConfig = m_fontConfig.get();
     const BMFontDef* fontDef = nullptr;
     char32_t prevChar = -1;
     float kerningAmount = 0;
@@ -1091,104 +2168,163 @@ void Label::updateChars() {
     float longestLine = 0;
     auto scaleFactor = cocos2d::CCDirector::get()->getContentScaleFactor();
 
-    std::vector<CCNode*> currentLine;
-    std::vector<size_t> indices(m_fontBatches.size() + 1, 0);
+    std::vector<LineLayout> lineLayouts;
+    lineLayouts.reserve(lines);
+    size_t lineBegin = 0;
     size_t emojiIndex = 0;
 
     for (uint32_t i = 0; i < stringLen; ++i) {
-        char32_t c = m_unicodeText[i];
+        char32_t c = text[i];
 
         if (c == '\n') {
+            lineLayouts.push_back({lineBegin, out.glyphs.size(), nextX / scaleFactor, {}, false});
+            lineBegin = out.glyphs.size();
             nextX = 0;
             nextY -= lineHeight;
-            m_lines.push_back(std::move(currentLine));
-            currentLine.clear();
             continue;
         }
 
         size_t fontIndex = 0;
         float scale = 1.f;
-        auto* batch = &m_mainBatch;
-        if (m_spriteSheetBatch && shouldParseDigitRegionalIndicator(std::u32string_view(m_unicodeText).substr(i))) {
+        currentConfig = m_fontConfig.get();
+        auto chunk = getChunkAt(i);
+        float chunkScale = m_useChunks ? m_chunks[chunk].scale : 1.f;
+        if (m_spriteSheetBatch && shouldParseDigitRegionalIndicator(text.substr(i))) {
+            if (!mainThread) {
+                return false;
+            }
             checkForEmoji(
-                m_unicodeText, i, scaleFactor,
+                text, i, scaleFactor,
                 nextX, nextY, commonHeight,
-                longestLine, currentLine,
+                longestLine, out.glyphs,
                 emojiIndex
             );
             continue;
         }
 
-        fontDef = getFontDefForChar(c, m_fontConfig, scale, fontIndex, batch, currentConfig);
+        fontDef = getFontDefForChar(
+            c, glyphs, i, mainThread, scale, fontIndex, currentConfig,
+            m_useChunks ? m_chunks[chunk].fontIndex : 0
+        );
         if (!fontDef) {
+            if (!mainThread) {
+                // without emoji, runtime glyphs or released fonts, characters no font has are skipped
+                if (m_spriteSheetBatch || m_runtimeFallback || hasReleasedFonts()) {
+                    return false;
+                }
+                continue;
+            }
             checkForEmoji(
-                m_unicodeText, i, scaleFactor,
+                text, i, scaleFactor,
                 nextX, nextY, commonHeight,
-                longestLine, currentLine,
+                longestLine, out.glyphs,
                 emojiIndex
             );
             continue;
         }
-
-        auto& index = indices[fontIndex];
-        kerningAmount = kerningAmountForChars(prevChar, c, currentConfig) * scale;
-
-        Rect rect = {
-            fontDef->rect.origin.x / scaleFactor, fontDef->rect.origin.y / scaleFactor,
-            fontDef->rect.size.width / scaleFactor, fontDef->rect.size.height / scaleFactor
-        };
-
-        // Re-using existing sprites for performance reasons
-        auto fontChar = getSpriteForChar(*batch, index, scale, rect);
-        currentLine.push_back(fontChar);
-        m_sprites.push_back(fontChar);
-
-        rect.size.width *= scale;
-        rect.size.height *= scale;
-
-        float yOffset = commonHeight - fontDef->yOffset * scale;
-        Vector fontPos = {
-            nextX + fontDef->xOffset * scale + fontDef->rect.size.width * 0.5f * scale + kerningAmount,
-            nextY + yOffset - rect.size.height * 0.5f * scaleFactor
-        };
-        fontChar->setPosition({
-            fontPos.x / scaleFactor,
-            fontPos.y / scaleFactor
-        });
+        scale *= chunkScale;
+
+        kerningAmount = kerningAmountForChars(prevChar, fontDef->charID, currentConfig) * scale;
+
+        // glyph rects of distance field fonts are in atlas texels, the metrics are already converted
+        float quadScale = scale * currentConfig->getTextureScale();
+
+        // final position is set when the line is finalized
+        float yOffset = commonHeight * chunkScale - fontDef->yOffset * scale;
+        auto& glyph = out.glyphs.emplace_back();
+        glyph.def = fontDef;
+        glyph.fontIndex = fontIndex;
+        glyph.chunk = chunk;
+        glyph.quadScale = quadScale;
+        glyph.position.x = (
+            nextX + fontDef->xOffset * scale + fontDef->rect.size.width * 0.5f * quadScale + kerningAmount
+        ) / scaleFactor;
+        glyph.position.y = (
+            nextY + yOffset - fontDef->rect.size.height * 0.5f * quadScale
+        ) / scaleFactor;
 
         // update kerning
         nextX += m_extraKerning + fontDef->xAdvance * scale + kerningAmount;
-        prevChar = c;
+        prevChar = fontDef->charID; // aliased glyphs kern as their target
 
         longestLine = std::max(longestLine, nextX);
-        ++index;
     }
-    m_lines.push_back(std::move(currentLine));
+    lineLayouts.push_back({lineBegin, out.glyphs.size(), nextX / scaleFactor, {}, false});
 
     float width = longestLine;
-    if (fontDef && fontDef->xAdvance < fontDef->rect.size.width) {
-        width += fontDef->rect.size.width - fontDef->xAdvance;
+    if (fontDef) {
+        // the last glyph can be wider than its advance, padding around the glyph doesn't count
+        auto& padding = currentConfig->getPadding();
+        auto glyphWidth = (fontDef->rect.size.width - padding.left - padding.right) * currentConfig->getTextureScale();
+        if (fontDef->xAdvance < glyphWidth) {
+            width += glyphWidth - fontDef->xAdvance;
+        }
     }
 
-    this->setContentSize({
+    // finalize the lines, Y positions are already known here.
+    // a single line always fills the content width, so it never needs an offset
+    for (auto& layout : lineLayouts) {
+        float offset = 0.f, gap = 0.f;
+        if (lineLayouts.size() > 1) {
+            getLineAlignment(layout, longestLine / scaleFactor, offset, gap);
+        }
+        finalizeLine(std::span(out.glyphs).subspan(layout.begin, layout.end - layout.begin), layout, offset, 0.f, gap);
+    }
+
+    out.size = {
         width / scaleFactor,
         (commonHeight * lines + m_extraLineSpacing * (lines - 1)) / scaleFactor
-    });
+    };
+    return true;
+}
+
+void Label::applyLayout() {
+    auto scaleFactor = cocos2d::CCDirector::get()->getContentScaleFactor();
+    std::vector<size_t> indices(m_fontBatches.size() + 2, 0); // + primary and runtime fonts
+    m_sprites.reserve(m_sprites.size() + m_layout.glyphs.size());
+
+    for (auto& glyph : m_layout.glyphs) {
+        if (glyph.node) {
+            glyph.node->setPosition(glyph.position);
+            continue;
+        }
 
-    this->updateAlignment();
+        auto& batch = glyph.fontIndex == 0 ? m_mainBatch
+            : glyph.fontIndex <= m_fontBatches.size() ? m_fontBatches[glyph.fontIndex - 1].batch
+            : m_runtimeBatch;
+        auto& rect = glyph.def->rect;
+
+        // Re-using existing sprites for performance reasons
+        auto fontChar = getSpriteForChar(batch, indices[glyph.fontIndex]++, glyph.quadScale, {
+            rect.origin.x / scaleFactor, rect.origin.y / scaleFactor,
+            rect.size.width / scaleFactor, rect.size.height / scaleFactor
+        });
+        fontChar->setPosition(glyph.position);
+        addSprite(fontChar, glyph.chunk);
+    }
+    releaseUnusedFonts(indices);
+
+    this->setContentSize(m_layout.size);
+
+    if (m_useChunks) {
+        updateColors();
+    }
+
+    this->updateMarquee();
 }
 
 void Label::updateColors() const {
-    for (auto sprite : m_sprites) {
-        if (m_useEmojiColors) {
-            sprite->setColor(m_color);
-            continue;
+    for (size_t i = 0; i < m_sprites.size(); ++i) {
+        auto sprite = m_sprites[i];
+        auto color = m_color;
+        if (m_useChunks && i < m_spriteChunks.size()) {
+            color = m_chunks[m_spriteChunks[i]].color.value_or(m_color);
         }
 
-        if (sprite->m_pParent == m_spriteSheetBatch.node) {
+        if (!m_useEmojiColors && sprite->m_pParent == m_spriteSheetBatch.node) {
             sprite->setColor(cocos2d::ccc3(255, 255, 255));
         } else {
-            sprite->setColor(m_color);
+            sprite->setColor(color);
         }
     }
 }
@@ -1212,10 +2348,12 @@ bool Label::init(std::string_view text, std::string const& font, BMFontAlignment
 
     m_font = font;
     m_alignment = alignment;
+    getLiveLabels().insert(this);
 
     m_mainBatch->setID("main-batch");
     this->setScale(scale);
     this->addChild(m_mainBatch.node, 0, 0);
+    updateBatchShader(m_mainBatch, m_fontConfig.get());
 
     this->setAnchorPoint({0.5f, 0.5f});
     this->setString(text);
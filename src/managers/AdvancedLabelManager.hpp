@@ -1,84 +1,98 @@
 #pragma once
-#include <Geode/Result.hpp>
+#include "BMFontConfiguration.hpp"
 #include <cocos2d.h>
 
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
+#include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
-struct BMKerningPair {
-    uint32_t first = 0;
-    uint32_t second = 0;
+/// @brief Font configuration that rasterizes glyphs on demand from a system (or bundled .ttf) font
+/// into a single shared atlas page. Used as the last fallback for scripts without a bundled atlas.
+/// Glyphs are drawn one codepoint at a time, so scripts that need shaping (Arabic, Devanagari) render unjoined.
+class DynamicFontAtlas : public BMFontConfiguration {
+public:
+    /// @brief Get the shared atlas for a font and line height (in texels). Empty font name uses the system UI font.
+    static std::shared_ptr<DynamicFontAtlas> get(std::string const& fontName, float lineHeight);
+    static void purgeCachedData();
 
-    bool operator==(const BMKerningPair& other) const = default;
+    DynamicFontAtlas() = default;
+    DynamicFontAtlas(DynamicFontAtlas const&) = delete;
+    DynamicFontAtlas& operator=(DynamicFontAtlas const&) = delete;
+    ~DynamicFontAtlas() override;
 
-    uint64_t toInt() const {
-        return static_cast<uint64_t>(first) << 32 | second;
-    }
-};
+    /// @brief Memory usage of the runtime atlases and their textures, reported with the bundled fonts.
+    static void collectMemoryStats(std::vector<memory::Usage>& out);
 
-struct BMFontDef {
-    uint32_t charID = 0;
-    cocos2d::CCRect rect = {0, 0, 0, 0};
-    float xOffset = 0;
-    float yOffset = 0;
-    float xAdvance = 0;
-};
+    /// @brief Get the glyph of a codepoint, rasterizing it on first use.
+    /// @return nullptr if the font can't draw it, or the atlas page is full
+    const BMFontDef* getGlyph(char32_t c);
 
-struct BMFontPadding {
-    int left = 0, top = 0, right = 0, bottom = 0;
-};
+    cocos2d::CCTexture2D* getTexture() const { return m_texture; }
 
-template <>
-struct std::hash<BMKerningPair> {
-    size_t operator()(BMKerningPair const& pair) const noexcept {
-        return std::hash<uint64_t>()(pair.toInt());
-    }
+protected:
+    bool init(std::string const& fontName, int fontSize);
+
+    /// @brief Rasterize text into white glyph pixels with coverage in the alpha channel.
+    bool rasterize(std::string const& text, std::vector<uint8_t>& outPixels, int& outWidth, int& outHeight) const;
+
+    cocos2d::CCTexture2D* m_texture = nullptr; // atlas page, updated in place
+    std::string m_fontName;                    // font passed to CCImage (system font name or .ttf path)
+    int m_fontSize = 0;                        // font size in texels
+    int m_cursorX = 0;                         // next free position on the current shelf
+    int m_cursorY = 0;                         // top of the current shelf
+    int m_shelfHeight = 0;                     // tallest glyph on the current shelf
+    bool m_full = false;                       // no more glyphs fit on the page
+    std::unordered_set<char32_t> m_missing;    // codepoints the font can't draw
 };
 
-/// @brief Reimplementation of the CCBMFontConfiguration class, with a few modifications to make it more modern.
-class BMFontConfiguration {
+
+/// @brief Codepoint trie compiled from an emoji map, used for longest-match emoji sequence lookup.
+/// Replaces hand-parsing ZWJ/skin tone/variation selector sequences and hashing the result.
+class EmojiTrie {
 public:
-    static BMFontConfiguration* create(std::string const& fntFile);
-    static void purgeCachedData();
-    BMFontConfiguration() = default;
+    using Map = std::unordered_map<std::u32string_view, const char*>;
 
-protected:
-    bool initWithFNTfile(std::string const& fntFile);
-    bool initWithContents(std::string const& contents, std::string const& fntFile);
+    /// @brief Get the compiled trie for an emoji map. Tries are cached per map, so the map must be global.
+    static EmojiTrie const& get(const Map* map);
 
-private:
-    geode::Result<> parseInfoArguments(std::istringstream& line);
-    geode::Result<> parseImageFileName(std::istringstream& line, std::string const& fntFile);
-    geode::Result<> parseCommonArguments(std::istringstream& line);
-    geode::Result<> parseCharacterDefinition(std::istringstream& line);
-    geode::Result<> parseKerningEntry(std::istringstream& line);
+    explicit EmojiTrie(Map const& map);
 
-public:
-    std::unordered_map<uint32_t, BMFontDef> const& getFontDefDictionary() const { return m_fontDefDictionary; }
-    std::unordered_map<BMKerningPair, float> const& getKerningDictionary() const { return m_kerningDictionary; }
-    float getCommonHeight() const { return m_commonHeight; }
-    BMFontPadding const& getPadding() const { return m_padding; }
-    std::string const& getAtlasName() const { return m_atlasName; }
+    /// @brief Find the longest sequence at the start of the text that is present in the map.
+    /// @return frame name of the sequence (or nullptr if nothing matched), and its length in outLength
+    const char* match(std::u32string_view text, size_t& outLength) const;
+
+    /// @brief Whether any sequence in the map starts with the codepoint.
+    bool startsSequence(char32_t c) const;
 
 protected:
-    std::unordered_map<uint32_t, BMFontDef> m_fontDefDictionary;
-    std::unordered_map<BMKerningPair, float> m_kerningDictionary;
-    float m_commonHeight = 0;
-    BMFontPadding m_padding;
-    std::string m_atlasName;
-};
+    struct Edge {
+        char32_t codepoint = 0;
+        uint32_t node = 0;
+    };
 
+    struct Node {
+        uint32_t firstEdge = 0;
+        uint32_t edgeCount = 0;
+        const char* value = nullptr;
+    };
+
+    std::vector<Node> m_nodes; // nodes in breadth-first order, root is at index 0
+    std::vector<Edge> m_edges; // edges of each node, stored contiguously and sorted by codepoint
+};
 
 enum class BMFontAlignment {
     Left,
     Center,
     Right,
-    Justify // TODO: implement justify
+    Justify // stretches wrapped lines to the widest line, lines ending in a newline stay left-aligned
 };
 
 /// @brief Multifunctional label node, that is more optimized and feature complete than the available CCLabelBMFont/TextArea ones.
@@ -109,14 +123,41 @@ public:
     /// @brief Create a wrapped label with text, bitmap font file, alignment, scale and wrap width.
     static Label* createWrapped(std::string_view text, std::string const& font, BMFontAlignment alignment, float scale, float wrapWidth);
 
+    ~Label() override;
+
+    /// @brief Memory collector for all live labels: layout buffers, glyph sprites and batch quad buffers.
+    static void collectMemoryStats(std::vector<memory::Usage>& out);
+
+    /// @brief Give live labels new runtime atlases after the game reloaded its textures.
+    /// Rasterized glyphs only exist in the atlas texture, so they are drawn again into a fresh one.
+    static void reloadRuntimeFallbacks();
+
 public:
-    using EmojiMap = std::unordered_map<std::u32string_view, const char*>;
+    using EmojiMap = EmojiTrie::Map;
     using CustomNodeMap = std::unordered_map<std::u32string_view, std::function<CCNode*(std::u32string_view, uint32_t&)>>;
 
+    /// @brief Styled run of text, used with setChunks.
+    struct Chunk {
+        std::string text;                               // UTF-8 encoded text of the run
+        std::optional<cocos2d::ccColor3B> color;        // run color (label color if not set)
+        float scale = 1.f;                              // glyph scale relative to the label, scaled from the bottom of the line
+        size_t fontIndex = 0;                           // preferred font (0 = regular lookup, N = N-th added font)
+    };
+
     /// @brief Set the contents of the label.
     void setString(std::string_view text);
+    /// @brief Set the contents of many labels at once (e.g. list rows). Decoding, normalization, glyph lookups
+    /// and line layout run in parallel on worker threads against the font configurations, then the results
+    /// are applied to the glyph sprites on the calling thread. Texts with emoji, custom nodes or runtime glyphs
+    /// are laid out on the calling thread. Must be called from the main thread, like setString.
+    static void setStrings(std::vector<std::pair<Label*, std::string_view>> const& labels);
     /// @brief Get the contents of the label.
     [[nodiscard]] std::string const& getString() const { return m_text; }
+    /// @brief Set the contents of the label as styled runs. Runs are laid out in a single pass and drawn
+    /// through the same batches, so mixed colors/scales don't need multiple labels. Cleared by setString.
+    void setChunks(std::vector<Chunk> chunks);
+    /// @brief Get the styled runs of the label (empty if the label was set with setString).
+    [[nodiscard]] std::vector<Chunk> const& getChunks() const { return m_chunks; }
     /// @brief Set the primary font of the label.
     void setFont(std::string const& font);
     /// @brief Add additional font to the label. (for multi-font labels)
@@ -141,6 +182,19 @@ public:
     void setAlignment(BMFontAlignment alignment);
     /// @brief Resize the label to fit the width.
     void limitLabelWidth(float width, float defaultScale, float minScale);
+    /// @brief Scroll the text inside a clipped area of the given width (in unscaled units) when it doesn't fit.
+    /// Text is only laid out when it changes, scrolling just moves the drawing offset.
+    void setMarquee(bool enabled, float width, float speed = 30.f);
+    /// @brief Whether the text is currently scrolling.
+    [[nodiscard]] bool isMarqueeActive() const { return m_marqueeActive; }
+    /// @brief Draw an outline of the given width (in points) around the glyphs. A width of 0 disables it.
+    /// Drawn by the text shader, so no extra nodes are created. The width is capped by the atlas spacing and padding.
+    void setOutline(cocos2d::ccColor4B const& color, float width);
+    /// @brief Draw a drop shadow at the given offset (in points) below the glyphs. A transparent color disables it.
+    /// Drawn by the text shader, so no extra nodes are created. The offset is capped by the atlas spacing and padding.
+    void setShadow(cocos2d::ccColor4B const& color, cocos2d::CCPoint const& offset);
+    /// @brief Rasterize characters missing from every font at runtime, from a system font or a .ttf path.
+    void setRuntimeFallback(bool enabled, std::string const& fontName = "");
     /// @brief Add all fonts in resources (hard coded because im lazy, this will crash if a font is missing). Music Integrations addition.
     void addAllFonts();
 
@@ -159,6 +213,9 @@ protected:
     struct CachedBatch {
         cocos2d::CCSpriteBatchNode* node = nullptr; // batch node
         std::vector<cocos2d::CCSprite*> sprites;    // initialized sprites for this batch
+        const BMFontConfiguration* config = nullptr; // font drawn by this batch (set by updateBatchShader)
+        float effectReach = 0.f;                    // outline/shadow distance in texels, capped by the atlas
+        float effectMargin = 0.f;                   // texels added around each glyph quad for the effects
 
         CachedBatch() = default;
         CachedBatch(cocos2d::CCSpriteBatchNode* node) : node(node) {}
@@ -176,36 +233,155 @@ protected:
 
     static float kerningAmountForChars(uint32_t first, uint32_t second, const BMFontConfiguration* config);
 
-    /// @brief Hide all characters of the label.
+    /// @brief Hide all characters of the label, and forget them until the next layout is applied.
     void hideAllChars();
 
-    /// @brief Update the characters of the label when it is not left-aligned.
-    void updateAlignment() const;
+    /// @brief Glyph or node placed by the layout. Glyph sprites are only fetched when the layout is applied,
+    /// so the layout itself doesn't need the nodes.
+    struct PlacedGlyph {
+        const BMFontDef* def = nullptr; // glyph of a font batch (nullptr for emoji and custom nodes)
+        CCNode* node = nullptr;         // emoji sprite or custom node, already set up by checkForEmoji
+        size_t fontIndex = 0;           // 0 = primary font, N = N-th added font, last = runtime font
+        size_t chunk = 0;               // chunk of the character, for coloring
+        float quadScale = 1.f;          // sprite scale
+        cocos2d::CCPoint position;      // center of the glyph, relative to its line until the line is finalized
+        float left = 0.f;               // left edge of the glyph without transparent padding, for wrapping
+    };
+
+    /// @brief Laid out text: placed glyphs in text order and the content size.
+    struct TextLayout {
+        std::vector<PlacedGlyph> glyphs;
+        cocos2d::CCSize size;
+    };
+
+    struct LineLayout {
+        size_t begin = 0;               // first placed glyph of the line
+        size_t end = 0;                 // end of the line in the placed glyphs
+        float width = 0.f;              // width of the line content, without trailing spaces
+        std::vector<size_t> wordStarts; // first node of the line and of each word after a space (gaps widened by justify)
+        bool wrapped = false;           // whether the line was ended by wrapping instead of a newline
+    };
+
+    /// @brief Get the horizontal offset and the extra gap between words for a line, based on the alignment.
+    void getLineAlignment(LineLayout const& layout, float contentWidth, float& outOffset, float& outGap) const;
+
+    /// @brief Move the glyphs of a line to their final positions, applying the alignment offset and line position.
+    static void finalizeLine(
+        std::span<PlacedGlyph> line, LineLayout const& layout,
+        float offsetX, float offsetY, float gap
+    );
 
     static float getWordWidth(std::vector<cocos2d::CCSprite*> const& word);
 
-    /// @brief Update the characters of the label when it is wrapped.
-    /// Will calculate the line breaks and update the characters accordingly.
-    void updateCharsWrapped();
+    /// @brief Word of a wrapped line, a view into the text.
+    struct WordSlice {
+        std::u32string_view text;
+        bool space = false;  // followed by a space
+        bool joined = false; // only break after this word if the following group doesn't fit on a line
+    };
+
+    /// @brief Split text into lines at newlines, and lines into words at UAX #14 break opportunities. [Internal]
+    /// A positive breakWords also splits words every breakWords characters.
+    static void splitWords(std::u32string_view text, int breakWords, std::vector<std::vector<WordSlice>>& outLines);
+
+    /// @brief splitWords for text below U+0100, which needs neither combining mark, joiner nor complex context handling,
+    /// so runs of letters and numbers cost a table lookup per character. Same result as the full split. [Internal]
+    /// @return false (and outLines as it was) if the text has a character from U+0100 on
+    static bool splitLatin1Words(std::u32string_view text, int breakWords, std::vector<std::vector<WordSlice>>& outLines);
+
+    /// @brief Glyph found for a character of m_unicodeText when the text was set.
+    struct ShapedGlyph {
+        const BMFontDef* def = nullptr; // nullptr if no atlas has it (emoji, runtime glyphs, custom nodes)
+        float scale = 1.f;              // font scale, without chunk scale
+        size_t fontIndex = 0;           // 0 = primary font, N = N-th added font
+    };
+
+    /// @brief Decode, normalize and look up the glyphs of a text. Only reads the font configurations,
+    /// so it can run on worker threads while the label isn't modified. [Internal]
+    bool shapeText(std::string_view text, std::u32string& outText, std::vector<ShapedGlyph>& outGlyphs) const;
+
+    /// @brief Replace the text with shaped text and lay it out. [Internal]
+    void applyShapedText(std::string_view text, std::u32string unicodeText, std::vector<ShapedGlyph> glyphs);
 
-    /// @brief Find the font definition for the specified character. [Internal]
+    /// @brief Lay out a shaped text on a single line per newline. [Internal]
+    /// Without mainThread only the font configurations and the layout settings are read, so it can run on a worker
+    /// thread while the label isn't modified. It then fails on characters that need emoji, custom nodes or runtime glyphs.
+    bool layoutText(std::u32string_view text, std::vector<ShapedGlyph> const& glyphs, bool mainThread, TextLayout& out);
+
+    /// @brief Lay out a shaped text, wrapping lines at the wrap width. Same rules as layoutText. [Internal]
+    bool layoutTextWrapped(std::u32string_view text, std::vector<ShapedGlyph> const& glyphs, bool mainThread, TextLayout& out);
+
+    /// @brief Fetch the sprites of m_layout and move every glyph and node to its position. [Internal]
+    void applyLayout();
+
+    /// @brief Look up a character in the bundled fonts only (no runtime glyphs). Thread safe. [Internal]
+    /// Exact glyphs in any font are preferred over aliased ones (see BMFontConfiguration::buildGlyphAliases).
+    /// A non-zero preferredFont is checked for an exact glyph before the regular lookup.
+    bool resolveGlyph(char32_t c, size_t preferredFont, ShapedGlyph& outGlyph) const;
+
+    /// @brief Find the font definition for the character at textIndex of a text. [Internal]
+    /// Uses the glyph found when the text was shaped if there is one, else resolveGlyph. On the main thread, released fonts
+    /// are acquired again while no exact glyph is found, then the runtime fallback is tried. Off it, fails if a released
+    /// font could have the glyph.
     const BMFontDef* getFontDefForChar(
-        char32_t c, const BMFontConfiguration* config,
+        char32_t c, std::vector<ShapedGlyph> const& glyphs, size_t textIndex, bool mainThread,
         float& outScale, size_t& outIndex,
-        CachedBatch*& outBatch,
+        BMFontConfiguration*& outConfig,
+        size_t preferredFont = 0
+    );
+
+    /// @brief Find a glyph for a character that no font has, rasterizing it at runtime if enabled. [Internal]
+    const BMFontDef* getRuntimeFontDef(
+        char32_t c, float& outScale, size_t& outIndex,
         BMFontConfiguration*& outConfig
     );
 
+    /// @brief Get the configuration of an added font released by releaseUnusedFonts again. Main thread only. [Internal]
+    /// @return whether the font is available
+    bool acquireFont(size_t index);
+
+    /// @brief Whether an added font is released (or failed to load), so its glyphs aren't known. [Internal]
+    [[nodiscard]] bool hasReleasedFonts() const;
+
+    /// @brief Release the configurations of added fonts that have no glyphs in the laid out text,
+    /// so the font cache can evict them under memory pressure. glyphCounts is indexed like CachedBatch indices. [Internal]
+    void releaseUnusedFonts(std::vector<size_t> const& glyphCounts);
+
+    /// @brief Get the chunk containing the character at the index of m_unicodeText. [Internal]
+    [[nodiscard]] size_t getChunkAt(size_t index) const;
+
+    /// @brief Register a laid out sprite, remembering its chunk for coloring. [Internal]
+    void addSprite(cocos2d::CCSprite* sprite, size_t chunk);
+
+    /// @brief Parse an emoji sequence by hand. Only used for custom node lookups. [Internal]
     std::u32string_view parseEmoji(std::u32string_view text, uint32_t& index) const;
 
     /// @brief Check for an emoji character and add it to the label if found. [Internal]
     void checkForEmoji(
         std::u32string_view text, uint32_t& index,
         float scaleFactor, float& nextX, float nextY, float commonHeight,
-        float& longestLine, std::vector<CCNode*>& currentLine,
+        float& longestLine, std::vector<PlacedGlyph>& outGlyphs,
         size_t& emojiIndex
     );
 
+    /// @brief Start or stop scrolling depending on the laid out width, and clamp the content size. [Internal]
+    void updateMarquee();
+
+    /// @brief Whether an outline or shadow is enabled.
+    [[nodiscard]] bool hasTextEffects() const;
+
+    /// @brief Whether any font batch is drawn with a custom shader that needs uniforms before drawing.
+    [[nodiscard]] bool hasCustomShaders() const;
+
+    /// @brief Assign the text shader (regular, effects or distance field) and recalculate the effect reach of a font batch. [Internal]
+    void updateBatchShader(CachedBatch& batch, const BMFontConfiguration* config) const;
+
+    /// @brief Upload the shader uniforms for a font batch, right before it is drawn. [Internal]
+    void setBatchUniforms(CachedBatch const& batch);
+
+    /// @brief Get the font batch of a batch node (nullptr for the emoji sheet and custom nodes). [Internal]
+    [[nodiscard]] const CachedBatch* getFontBatch(CCNode* batchNode) const;
+
     /// @brief Fetches or creates a sprite with the provided rect. [Internal]
     cocos2d::CCSprite* getSpriteForChar(
         CachedBatch& batch, size_t index,
@@ -213,8 +389,7 @@ protected:
     ) const;
 
 public:
-    /// @brief Update the characters of the label when it is not wrapped.
-    /// Automatically calculates the line breaks and updates the characters accordingly.
+    /// @brief Lay out the text again and update the characters accordingly.
     void updateChars();
 
     /// @brief Update the colors of all characters.
@@ -223,6 +398,12 @@ public:
     /// @brief Update the opacity of all characters.
     void updateOpacity() const;
 
+    /// @brief Draws the children clipped and offset when the marquee is active.
+    void visit() override;
+
+    /// @brief Advances the marquee scroll offset.
+    void update(float dt) override;
+
 public:
     /// === CCRGBAProtocol ===
 
@@ -269,7 +450,7 @@ protected:
     std::string m_font;                                  // primary font atlas name
     std::u32string m_unicodeText;                        // UTF-32 encoded text
     BMFontAlignment m_alignment = BMFontAlignment::Left; // text alignment
-    BMFontConfiguration* m_fontConfig = nullptr;         // primary font configuration
+    std::shared_ptr<BMFontConfiguration> m_fontConfig;   // primary font configuration
     int m_breakWords = -1;                               // break words when wrapping by N chars groups (default -1 = no break)
     bool m_useWrap = false;                              // enable line wrapping
     bool m_useEmojiColors = false;                       // enable emoji colorization
@@ -277,9 +458,25 @@ protected:
     float m_extraLineSpacing = 0.f;                      // additional spacing between lines
     float m_extraKerning = 0.f;                          // additional kerning between characters
 
+    // Marquee properties
+    bool m_useMarquee = false;     // scroll the text when it is wider than m_marqueeWidth
+    bool m_marqueeActive = false;  // text is currently wider than the marquee and scrolling
+    float m_marqueeWidth = 0.f;    // visible width of the marquee
+    float m_marqueeSpeed = 30.f;   // scroll speed in units per second
+    float m_marqueeOffset = 0.f;   // current scroll offset
+    float m_marqueeHold = 0.f;     // time left before the text starts scrolling again
+    float m_textWidth = 0.f;       // full width of the laid out text
+
+    // Text effects (drawn by the text shader)
+    cocos2d::ccColor4B m_outlineColor = {0, 0, 0, 255}; // outline color
+    float m_outlineWidth = 0.f;                          // outline width in points
+    cocos2d::ccColor4B m_shadowColor = {0, 0, 0, 0};     // drop shadow color
+    cocos2d::CCPoint m_shadowOffset = {0.f, 0.f};        // drop shadow offset in points
+
     // Children
     struct FontCfg {
-        BMFontConfiguration* config; // font configuration
+        std::string file;                            // font file, to get the configuration again once released
+        std::shared_ptr<BMFontConfiguration> config; // font configuration (released while the text doesn't use the font)
         CachedBatch batch;           // corresponding batch node
         std::optional<float> scale;  // auto scale by default
     };
@@ -287,21 +484,20 @@ protected:
     CachedBatch m_mainBatch;            // Primary font batch
     CachedBatch m_spriteSheetBatch;     // Sprite sheet batch for emoji characters
     std::vector<FontCfg> m_fontBatches; // Font batches for alternate fonts
+    CachedBatch m_runtimeBatch;         // Batch for glyphs rasterized at runtime
+    std::shared_ptr<DynamicFontAtlas> m_runtimeFallback; // Runtime rasterized fallback font
+    std::string m_runtimeFontName;      // font used for runtime rasterization (empty = system font)
     std::vector<CCNode*> m_customNodes; // Custom nodes to be added to the label
 
     // Internal properties
-    //  struct Chunk {
-    //      std::u32string text;
-    //      cocos2d::ccColor3B color = cocos2d::ccc3(255, 255, 255);
-    //      float scale = 1.f;
-    //      size_t fontIndex = 0;
-    //      cocos2d::CCSprite* sprite = nullptr;
-    //  };
-
     const EmojiMap* m_emojiMap = nullptr;            // emoji map (MAP SHOULD BE GLOBAL AND NEVER DESTROYED)
+    const EmojiTrie* m_emojiTrie = nullptr;          // trie compiled from the emoji map
     const CustomNodeMap* m_customNodeMap = nullptr;  // custom node map (MAP SHOULD BE GLOBAL AND NEVER DESTROYED)
-    std::vector<std::vector<CCNode*>> m_lines;       // lines of characters
+    TextLayout m_layout;                             // layout of the text (kept to reuse its buffer)
     std::vector<cocos2d::CCSprite*> m_sprites;       // all sprites in the label (for faster access)
-    //  std::vector<Chunk> m_chunks;                 // chunks containing metadata
-    //  bool m_useChunks = false;                    // whether to use chunks instead of raw text
+    std::vector<Chunk> m_chunks;                     // chunks containing metadata
+    std::vector<size_t> m_chunkEnds;                 // end of each chunk in m_unicodeText
+    std::vector<size_t> m_spriteChunks;              // chunk of each sprite in m_sprites (only with chunks)
+    std::vector<ShapedGlyph> m_shapedGlyphs;         // glyph of each character in m_unicodeText (empty if not shaped)
+    bool m_useChunks = false;                        // whether to use chunks instead of raw text
 };
\ No newline at end of file
@@ -0,0 +1,407 @@
+#include "BMFontConfiguration.hpp"
+#include "../utils/Unicode.hpp"
+#include <Geode/loader/Log.hpp>
+#include <Geode/utils/file.hpp>
+#include <Geode/utils/general.hpp>
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <sstream>
+#include <type_traits>
+
+struct CachedFontConfig {
+    std::shared_ptr<BMFontConfiguration> config;
+    size_t memoryUsage = 0; // measured once after loading
+    uint64_t lastUse = 0;   // value of s_fontConfigUses when last requested
+};
+
+std::unordered_map<std::string, CachedFontConfig>& getFontConfigs() {
+    static std::unordered_map<std::string, CachedFontConfig> s_fontConfigs;
+    return s_fontConfigs;
+}
+
+static uint64_t s_fontConfigUses = 0;
+static size_t s_fontMemoryBudget = 2 * 1024 * 1024;
+
+std::shared_ptr<BMFontConfiguration> BMFontConfiguration::create(std::string const& fntFile) {
+    auto& s_fontConfigs = getFontConfigs();
+
+    // check if the font config is already loaded
+    auto it = s_fontConfigs.find(fntFile);
+    if (it != s_fontConfigs.end()) {
+        it->second.lastUse = ++s_fontConfigUses;
+        return it->second.config;
+    }
+
+    // load the font config
+    auto config = std::make_shared<BMFontConfiguration>();
+    if (!config->initWithFNTfile(fntFile)) {
+        return nullptr;
+    }
+    s_fontConfigs.emplace(fntFile, CachedFontConfig{config, config->getMemoryUsage(), ++s_fontConfigUses});
+
+    trimCache();
+    return config;
+}
+
+void BMFontConfiguration::purgeCachedData() {
+    getFontConfigs().clear();
+}
+
+void BMFontConfiguration::setMemoryBudget(size_t bytes) {
+    s_fontMemoryBudget = bytes;
+    trimCache();
+}
+
+void BMFontConfiguration::trimCache() {
+    auto& s_fontConfigs = getFontConfigs();
+
+    size_t total = 0;
+    for (auto& [file, cached] : s_fontConfigs) {
+        total += cached.memoryUsage;
+    }
+
+    while (total > s_fontMemoryBudget) {
+        // least recently requested configuration that only the cache holds
+        auto victim = s_fontConfigs.end();
+        for (auto it = s_fontConfigs.begin(); it != s_fontConfigs.end(); ++it) {
+            if (it->second.config.use_count() == 1
+                && (victim == s_fontConfigs.end() || it->second.lastUse < victim->second.lastUse)) {
+                victim = it;
+            }
+        }
+
+        if (victim == s_fontConfigs.end()) {
+            break;
+        }
+
+        geode::log::debug("Evicting font '{}' ({} KiB)", victim->first, victim->second.memoryUsage / 1024);
+        // the atlas is by far the larger part, it's freed once no released label batch holds it anymore
+        cocos2d::CCTextureCache::get()->removeTextureForKey(victim->second.config->getAtlasName().c_str());
+        total -= victim->second.memoryUsage;
+        s_fontConfigs.erase(victim);
+    }
+}
+
+void BMFontConfiguration::collectMemoryStats(std::vector<memory::Usage>& out) {
+    for (auto& [file, cached] : getFontConfigs()) {
+        out.push_back({file, cached.memoryUsage, cached.config->getFontDefDictionary().size()});
+    }
+}
+
+size_t BMFontConfiguration::getMemoryUsage() const {
+    // nodes of std::unordered_map hold the next pointer and the value, plus a bucket pointer per bucket
+    auto mapUsage = [](auto const& map) {
+        using Value = typename std::decay_t<decltype(map)>::value_type;
+        return map.size() * (sizeof(void*) + sizeof(Value)) + map.bucket_count() * sizeof(void*);
+    };
+
+    return sizeof(*this) + mapUsage(m_fontDefDictionary) + mapUsage(m_kerningDictionary) + m_atlasName.capacity();
+}
+
+bool BMFontConfiguration::initWithFNTfile(std::string const& fntFile) {
+    #if defined(GEODE_IS_MOBILE) || !defined(NDEBUG)
+    // on android, accessing internal assets manually won't work,
+    // so we're just going to use cocos functions as intended.
+    // oh and fullPathForFilename apparently crashes in debug mode, so we're using this in that case as well
+    unsigned long size = 0;
+    auto data = cocos2d::CCFileUtils::sharedFileUtils()->getFileData(fntFile.c_str(), "rb", &size);
+    if (!data || size == 0) {
+        geode::log::error("Failed to read file '{}'", fntFile);
+        return false;
+    }
+    auto contents = std::string(reinterpret_cast<char*>(data), size);
+    #else
+    // for non-android, we can speed up reading by doing it manually
+    std::string fullPath = cocos2d::CCFileUtils::get()->fullPathForFilename(fntFile.c_str(), false);
+    auto contents = geode::utils::file::readString(fullPath).unwrapOrDefault();
+    if (contents.empty()) {
+        geode::log::error("Failed to read file '{}'", fullPath);
+        return false;
+    }
+    #endif
+
+    return initWithContents(contents, fntFile);
+}
+
+#define WRAP_PARSE(expr) if (auto res = (expr); res.isErr()) { geode::log::error("{}", res.unwrapErr()); return false; }
+
+bool BMFontConfiguration::initWithContents(std::string const& contents, std::string const& fntFile) {
+    std::istringstream stream(contents);
+    std::string line;
+
+    while (std::getline(stream, line)) {
+        if (line.empty()) {
+            continue;
+        }
+
+        std::istringstream lineStream(line);
+        std::string type;
+        lineStream >> type;
+
+        if (type == "info") {
+            WRAP_PARSE(parseInfoArguments(lineStream));
+        } else if (type == "common") {
+            WRAP_PARSE(parseCommonArguments(lineStream));
+        } else if (type == "page") {
+            WRAP_PARSE(parseImageFileName(lineStream, fntFile));
+        } else if (type == "char") {
+            WRAP_PARSE(parseCharacterDefinition(lineStream));
+        } else if (type == "kerning") {
+            WRAP_PARSE(parseKerningEntry(lineStream));
+        } else if (type == "distanceField") {
+            WRAP_PARSE(parseDistanceField(lineStream));
+        }
+    }
+
+    if (isDistanceField()) {
+        applyTextureScale();
+    }
+
+    buildGlyphAliases();
+
+    return true;
+}
+
+template <class T>
+T fastParse(std::string_view str) {
+    auto value = geode::utils::numFromString<T>(str).unwrapOrDefault();
+    if constexpr (std::is_floating_point_v<T>) {
+        // "nan" and "inf" parse fine, but would poison every layout using the font
+        if (!std::isfinite(value)) {
+            return T{};
+        }
+    }
+    return value;
+}
+
+geode::Result<> BMFontConfiguration::parseInfoArguments(std::istringstream& line) {
+    std::string keypair;
+
+    while (line >> keypair) {
+        auto eqPos = keypair.find('=');
+        if (eqPos == std::string::npos) {
+            continue;
+        }
+
+        auto key = keypair.substr(0, eqPos);
+        auto value = keypair.substr(eqPos + 1);
+
+        if (key == "padding") {
+            std::istringstream paddingStream(value);
+            char comma;
+            paddingStream >> m_padding.left >> comma >> m_padding.top >> comma >> m_padding.right >> comma >> m_padding.bottom;
+        } else if (key == "spacing") {
+            std::istringstream spacingStream(value);
+            char comma;
+            spacingStream >> m_spacing.horizontal >> comma >> m_spacing.vertical;
+        }
+    }
+
+    return geode::Ok();
+}
+
+geode::Result<> BMFontConfiguration::parseImageFileName(std::istringstream& line, std::string const& fntFile) {
+    std::string keypair;
+
+    while (line >> keypair) {
+        auto eqPos = keypair.find('=');
+        if (eqPos == std::string::npos) {
+            continue;
+        }
+
+        auto key = keypair.substr(0, eqPos);
+        auto value = keypair.substr(eqPos + 1);
+
+        if (key == "file") {
+            // quotes are optional
+            auto relPath = value;
+            if (relPath.size() >= 2 && relPath.front() == '"' && relPath.back() == '"') {
+                relPath = relPath.substr(1, relPath.size() - 2);
+            }
+            if (relPath.empty()) {
+                return geode::Err("Empty image file name");
+            }
+
+            m_atlasName = cocos2d::CCFileUtils::get()->fullPathFromRelativeFile(
+                relPath.c_str(), fntFile.c_str()
+            );
+        }
+    }
+
+    if (m_atlasName.empty()) {
+        return geode::Err("Failed to parse image file name");
+    }
+
+    return geode::Ok();
+}
+
+geode::Result<> BMFontConfiguration::parseCommonArguments(std::istringstream& line) {
+    std::string keypair;
+
+    while (line >> keypair) {
+        auto eqPos = keypair.find('=');
+        if (eqPos == std::string::npos) {
+            continue;
+        }
+
+        auto key = keypair.substr(0, eqPos);
+        auto value = keypair.substr(eqPos + 1);
+
+        if (key == "lineHeight") {
+            m_commonHeight = fastParse<float>(value);
+        } else if (key == "scaleW" || key == "scaleH") {
+            if (fastParse<int>(value) > cocos2d::CCConfiguration::sharedConfiguration()->m_nMaxTextureSize) {
+                return geode::Err("Font size exceeds max texture size");
+            }
+        } else if (key == "pages") {
+            if (fastParse<int>(value) != 1) {
+                return geode::Err("Font must have exactly one page");
+            }
+        }
+    }
+
+    return geode::Ok();
+}
+
+geode::Result<> BMFontConfiguration::parseCharacterDefinition(std::istringstream& line) {
+    BMFontDef def;
+    std::string keypair;
+
+    while (line >> keypair) {
+        auto eqPos = keypair.find('=');
+        if (eqPos == std::string::npos) {
+            continue;
+        }
+
+        auto key = keypair.substr(0, eqPos);
+        auto value = keypair.substr(eqPos + 1);
+
+        if (key == "id") {
+            def.charID = fastParse<uint32_t>(value);
+        } else if (key == "x") {
+            def.rect.origin.x = fastParse<int>(value);
+        } else if (key == "y") {
+            def.rect.origin.y = fastParse<int>(value);
+        } else if (key == "width") {
+            def.rect.size.width = fastParse<int>(value);
+        } else if (key == "height") {
+            def.rect.size.height = fastParse<int>(value);
+        } else if (key == "xoffset") {
+            def.xOffset = fastParse<float>(value);
+        } else if (key == "yoffset") {
+            def.yOffset = fastParse<float>(value);
+        } else if (key == "xadvance") {
+            def.xAdvance = fastParse<float>(value);
+        }
+    }
+
+    m_fontDefDictionary[def.charID] = def;
+    // m_characterSet.insert(def.charID);
+
+    return geode::Ok();
+}
+
+geode::Result<> BMFontConfiguration::parseKerningEntry(std::istringstream& line) {
+    std::string keypair;
+    std::optional<uint32_t> first, second;
+    std::optional<float> amount;
+
+    while (line >> keypair) {
+        auto eqPos = keypair.find('=');
+        if (eqPos == std::string::npos) {
+            continue;
+        }
+
+        auto key = keypair.substr(0, eqPos);
+        auto value = keypair.substr(eqPos + 1);
+
+        if (key == "first") {
+            first = fastParse<uint32_t>(value);
+        } else if (key == "second") {
+            second = fastParse<uint32_t>(value);
+        } else if (key == "amount") {
+            amount = fastParse<float>(value);
+        }
+    }
+
+    if (!first || !second || !amount) {
+        return geode::Err("Kerning entry is missing first, second or amount");
+    }
+
+    m_kerningDictionary[{*first, *second}] = *amount;
+    return geode::Ok();
+}
+
+// distanceField fieldType=sdf distanceRange=8 contentScale=2
+// contentScale is our own addition (see tools/gen_sdf_fonts.py), the atlas is drawn for that content scale
+geode::Result<> BMFontConfiguration::parseDistanceField(std::istringstream& line) {
+    std::string keypair;
+
+    while (line >> keypair) {
+        auto eqPos = keypair.find('=');
+        if (eqPos == std::string::npos) {
+            continue;
+        }
+
+        auto key = keypair.substr(0, eqPos);
+        auto value = keypair.substr(eqPos + 1);
+
+        if (key == "fieldType") {
+            if (value != "sdf") {
+                return geode::Err(fmt::format("Unsupported distance field type '{}'", value));
+            }
+        } else if (key == "distanceRange") {
+            m_distanceRange = fastParse<float>(value);
+        } else if (key == "contentScale") {
+            m_atlasScale = fastParse<float>(value);
+        }
+    }
+
+    if (m_distanceRange <= 0.f || m_atlasScale <= 0.f) {
+        return geode::Err("Invalid distance field parameters");
+    }
+
+    return geode::Ok();
+}
+
+void BMFontConfiguration::applyTextureScale() {
+    // cached configs are purged when the texture quality changes, so the content scale is fixed for this config
+    m_textureScale = cocos2d::CCDirector::get()->getContentScaleFactor() / m_atlasScale;
+
+    m_commonHeight *= m_textureScale;
+    for (auto& [id, def] : m_fontDefDictionary) {
+        def.xOffset *= m_textureScale;
+        def.yOffset *= m_textureScale;
+        def.xAdvance *= m_textureScale;
+    }
+    for (auto& [pair, amount] : m_kerningDictionary) {
+        amount *= m_textureScale;
+    }
+}
+
+#undef WRAP_PARSE
+
+float BMFontConfiguration::getEffectReach() const {
+    // the closest neighbouring glyph is `spacing` texels away, with transparent padding inside both rects.
+    // growing the quad by N texels and sampling N texels further must stay within that gap
+    auto spacing = std::min(m_spacing.horizontal, m_spacing.vertical);
+    auto padding = std::min({m_padding.left, m_padding.top, m_padding.right, m_padding.bottom});
+    return std::max(0.f, (spacing + 2.f * padding) * 0.5f);
+}
+
+void BMFontConfiguration::buildGlyphAliases() {
+    unicode::forEachGlyphAlias([this](char32_t alias, char32_t target) {
+        if (m_fontDefDictionary.contains(alias)) {
+            return;
+        }
+
+        // only alias onto real glyphs, never onto other aliases
+        auto it = m_fontDefDictionary.find(target);
+        if (it == m_fontDefDictionary.end() || it->second.charID != target) {
+            return;
+        }
+
+        m_fontDefDictionary.emplace(alias, it->second);
+    });
+}
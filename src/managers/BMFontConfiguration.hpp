@@ -0,0 +1,120 @@
+#pragma once
+#include "../utils/MemoryStats.hpp"
+#include <Geode/Result.hpp>
+#include <cocos2d.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct BMKerningPair {
+    uint32_t first = 0;
+    uint32_t second = 0;
+
+    bool operator==(const BMKerningPair& other) const = default;
+
+    uint64_t toInt() const {
+        return static_cast<uint64_t>(first) << 32 | second;
+    }
+};
+
+struct BMFontDef {
+    uint32_t charID = 0;
+    cocos2d::CCRect rect = {0, 0, 0, 0};
+    float xOffset = 0;
+    float yOffset = 0;
+    float xAdvance = 0;
+};
+
+struct BMFontPadding {
+    int left = 0, top = 0, right = 0, bottom = 0;
+};
+
+struct BMFontSpacing {
+    int horizontal = 0, vertical = 0;
+};
+
+template <>
+struct std::hash<BMKerningPair> {
+    size_t operator()(BMKerningPair const& pair) const noexcept {
+        return std::hash<uint64_t>()(pair.toInt());
+    }
+};
+
+/// @brief Reimplementation of the CCBMFontConfiguration class, with a few modifications to make it more modern.
+/// Configurations are shared: the cache and every label using one hold a reference, so evicting it from the cache
+/// never invalidates a label.
+class BMFontConfiguration {
+public:
+    /// @brief Get the configuration of a font file, loading it if it isn't cached.
+    static std::shared_ptr<BMFontConfiguration> create(std::string const& fntFile);
+    /// @brief Drop all cached configurations. Labels keep the ones they hold until they release them.
+    static void purgeCachedData();
+    /// @brief Set how much memory the glyph and kerning tables of cached configurations may use before unused ones are
+    /// evicted (least recently requested first). Configurations held by labels are never evicted.
+    static void setMemoryBudget(size_t bytes);
+    /// @brief Evict unused configurations until the cache fits in the memory budget.
+    /// Their atlases are removed from the texture cache along with them.
+    static void trimCache();
+    /// @brief Memory collector for cached font configurations and runtime atlases (see memory::registerCollector).
+    static void collectMemoryStats(std::vector<memory::Usage>& out);
+    BMFontConfiguration() = default;
+    virtual ~BMFontConfiguration() = default;
+
+    /// @brief Approximate heap memory used by the glyph and kerning tables, in bytes.
+    size_t getMemoryUsage() const;
+
+protected:
+    bool initWithFNTfile(std::string const& fntFile);
+    bool initWithContents(std::string const& contents, std::string const& fntFile);
+
+private:
+    geode::Result<> parseInfoArguments(std::istringstream& line);
+    geode::Result<> parseImageFileName(std::istringstream& line, std::string const& fntFile);
+    geode::Result<> parseCommonArguments(std::istringstream& line);
+    geode::Result<> parseCharacterDefinition(std::istringstream& line);
+    geode::Result<> parseKerningEntry(std::istringstream& line);
+    geode::Result<> parseDistanceField(std::istringstream& line);
+
+    /// @brief Convert the metrics of a distance field font from atlas texels to texels of the current content scale.
+    /// Glyph rects stay in atlas texels, Label scales the glyph quads by getTextureScale instead.
+    void applyTextureScale();
+
+    /// @brief Add case-folded and compatibility variants of existing glyphs to the font definitions,
+    /// so that missing glyphs resolve in the same lookup. Aliased definitions keep the charID of their target glyph.
+    void buildGlyphAliases();
+
+public:
+    std::unordered_map<uint32_t, BMFontDef> const& getFontDefDictionary() const { return m_fontDefDictionary; }
+    std::unordered_map<BMKerningPair, float> const& getKerningDictionary() const { return m_kerningDictionary; }
+    float getCommonHeight() const { return m_commonHeight; }
+    BMFontPadding const& getPadding() const { return m_padding; }
+    BMFontSpacing const& getSpacing() const { return m_spacing; }
+    /// @brief Get how far (in texels) around a glyph can be sampled without reaching into a neighbouring glyph,
+    /// when the glyph quad is also grown by the same distance. Limits shader outlines and shadows.
+    float getEffectReach() const;
+    /// @brief Whether the atlas stores signed distances instead of coverage.
+    bool isDistanceField() const { return m_distanceRange > 0.f; }
+    /// @brief Texels over which the stored distance goes from 0 to 1 (0 for bitmap fonts).
+    float getDistanceRange() const { return m_distanceRange; }
+    /// @brief Atlas texels per point of a distance field font.
+    float getAtlasScale() const { return m_atlasScale; }
+    /// @brief Content scale texels per atlas texel. Bitmap fonts ship an atlas per content scale, so this is 1 for them.
+    float getTextureScale() const { return m_textureScale; }
+    std::string const& getAtlasName() const { return m_atlasName; }
+
+protected:
+    std::unordered_map<uint32_t, BMFontDef> m_fontDefDictionary;
+    std::unordered_map<BMKerningPair, float> m_kerningDictionary;
+    float m_commonHeight = 0;
+    BMFontPadding m_padding;
+    BMFontSpacing m_spacing;
+    std::string m_atlasName;
+    float m_distanceRange = 0.f; // distance field range in atlas texels (0 = bitmap font)
+    float m_atlasScale = 1.f;    // atlas texels per point (distance field fonts)
+    float m_textureScale = 1.f;  // content scale texels per atlas texel
+};
@@ -2,6 +2,9 @@
 #include "Geode/loader/Log.hpp"
 #include "PlaybackManager.hpp"
 #include "AdvancedLabelManager.hpp"
+#include "../ui/memoryStats.hpp"
+#include "../ui/trackProgress.hpp"
+#include "../utils/MemoryStats.hpp"
 #include <Geode/Geode.hpp>
 #include <Geode/loader/Dispatch.hpp>
 #include <Geode/ui/GeodeUI.hpp>
@@ -15,7 +18,8 @@ protected:
 	CCScale9Sprite* m_bg;
 	Label* m_musicTitle;
     Label* m_musicArtist;
-    LazySprite* m_musicImage;
+    LazySprite* m_musicImage = nullptr;
+    TrackProgressBar* m_progressBar = nullptr;
     CCLabelBMFont* m_unavailableLabel;
     CCLabelBMFont* m_autoLabel;
     CCMenu* m_menu;
@@ -25,15 +29,10 @@ protected:
     CCMenuItemSpriteExtra* m_skipBtn;
     CCMenuItemToggler* m_autoBtn;
     PlaybackManager& pbm = PlaybackManager::get();
-    ListenerHandle m_titleListener;
-    ListenerHandle m_artistListener;
+    ListenerHandle m_nowPlayingListener;
     ListenerHandle m_imageListener;
     ListenerHandle m_playbackListener;
 
-    arc::TaskHandle<void> m_pollingTask;
-    int m_pollingCooldown = 0;
-    bool m_pollingToggle = false;
-
 
 	bool init() override {
 		if (!CCLayer::init())
@@ -62,17 +61,28 @@ protected:
         #endif
             m_musicTitle = Label::create("No Song", "font_default.fnt"_spr);
             m_musicTitle->addAllFonts();
-            m_musicTitle->limitLabelWidth(200.f, 1.5, 0.1f);
+            m_musicTitle->setRuntimeFallback(true);
+            m_musicTitle->setScale(1.5f);
+            m_musicTitle->setMarquee(true, 200.f / 1.5f);
+            m_musicTitle->setShadow({0, 0, 0, 160}, {1.f, -1.f});
             m_musicTitle->setAnchorPoint({0.f, 0.5f});
             this->addChildAtPosition(m_musicTitle, Anchor::Top, ccp(-100, -25));
 
             m_musicArtist = Label::create("No Artist", "font_default.fnt"_spr);
             m_musicArtist->addAllFonts();
+            m_musicArtist->setRuntimeFallback(true);
             m_musicArtist->setColor({253, 205, 52});
-            m_musicArtist->limitLabelWidth(200.f, 1.2, 0.1f); 
+            m_musicArtist->setScale(1.2f);
+            m_musicArtist->setMarquee(true, 200.f / 1.2f);
+            m_musicArtist->setShadow({0, 0, 0, 160}, {1.f, -1.f});
             m_musicArtist->setAnchorPoint({0.f, 0.5f});
             this->addChildAtPosition(m_musicArtist, Anchor::Top, ccp(-100, -55));
 
+            // only Spotify reports the track duration, see update()
+            m_progressBar = TrackProgressBar::create(300.f);
+            m_progressBar->setVisible(false);
+            this->addChildAtPosition(m_progressBar, Anchor::Top, ccp(-100, -72));
+
             m_musicImage = LazySprite::create({this->getContentSize().height*0.85f, this->getContentSize().height*0.85f});
             m_musicImage->setAutoResize(true);
             this->addChildAtPosition(m_musicImage, Anchor::Left, ccp(10 + m_musicImage->getContentSize().width/2, 0));
@@ -125,6 +135,13 @@ protected:
             m_menu->addChild(m_playbackBtn);
             m_menu->addChild(m_skipBtn);
             m_menu->addChild(m_autoBtn);
+            #ifdef DEBUG_BUILD
+            m_menu->addChild(CCMenuItemSpriteExtra::create(
+                CCSprite::createWithSpriteFrameName("GJ_infoIcon_001.png"),
+                this,
+                menu_selector(MusicControlOverlay::onMemoryStats)
+            ));
+            #endif
             m_menu->setTouchPriority(-999);
             m_menu->updateLayout();
             this->addChildAtPosition(m_menu, Anchor::Bottom, ccp(10, this->getContentHeight()/4));
@@ -155,6 +172,12 @@ protected:
         pbm.skip(false);
     }
 
+    #ifdef DEBUG_BUILD
+    void onMemoryStats(CCObject*) {
+        memoryStatsPopup::create()->show();
+    }
+    #endif
+
     void onToggleAuto(CCObject* btn) {
         auto enabled = Mod::get()->getSavedValue<bool>("autoEnabled");
         Mod::get()->setSavedValue<bool>("autoEnabled", !enabled);
@@ -261,22 +284,18 @@ protected:
 
     void onEnter() override {
         CCLayer::onEnter();
+        this->scheduleUpdate();
         CCDirector::sharedDirector()->getTouchDispatcher()->addTargetedDelegate(this, -999, true);
-        m_titleListener = PlaybackManager::SongUpdateEvent("title-update"_spr).listen([this](auto title) {
-            if (!title.empty()) this->updateTitle(title);
-            return ListenerResult::Propagate;
-        });
-        m_artistListener = PlaybackManager::SongUpdateEvent("artist-update"_spr).listen([this](auto artist) {
-            if (!artist.empty()) this->updateArtist(artist);
+        m_nowPlayingListener = PlaybackManager::NowPlayingUpdateEvent("now-playing-update"_spr).listen([this](NowPlaying np, uint32_t changed) {
+            this->applyNowPlaying(np, changed);
             return ListenerResult::Propagate;
         });
+        // catch up on whatever changed while the overlay was not in the scene
+        if (auto& current = pbm.getNowPlaying(); current.version > 0) {
+            this->applyNowPlaying(current, NowPlaying::Title | NowPlaying::Artist | NowPlaying::Art);
+        }
 
-        if (!pbm.isWindows()) {
-            m_imageListener = PlaybackManager::SongUpdateEvent("image-update"_spr).listen([this](auto image) {
-                if (!image.empty()) this->updateImageFromUrl(image);
-                return ListenerResult::Propagate;
-            });
-        } else {
+        if (pbm.isWindows()) {
             m_imageListener = PlaybackManager::ThumbnailUpdateEvent("image-update"_spr).listen([this](auto image) {
                 if (!image.empty()) this->updateImageFromData(image);
                 return ListenerResult::Propagate;
@@ -289,46 +308,30 @@ protected:
             togglePlaybackBtn(status);
         });
         if(Mod::get()->getSavedValue<bool>("hasAuthorized") && !pbm.isWindows()) {
-            std::string token = Mod::get()->getSavedValue<std::string>("spotify-token", "");
-            if (token.empty()) {
-                log::error("No Spotify token available");
-                return;
-            }
-
-            PlaybackManager::get().spotifyGetPlaybackInfo(token, 0);
-
-            arc::Notify notify;
-
-            async::spawn([notify] -> arc::Future<> {
-                while (true) {
-                    notify.notifyOne();
-                    co_await arc::sleep(asp::Duration::fromSecs(1));
-                }
-            });
-
-            m_pollingTask = async::spawn([notify, token, this] -> arc::Future<> {
-                while (true) {
-                    co_await notify.notified();
-                    if (m_pollingCooldown > 0) m_pollingCooldown -= 1;
-                    
-                    if (m_pollingCooldown <= 0 && m_pollingToggle &&Mod::get()->getSavedValue<bool>("hasAuthorized")) {
-                        PlaybackManager::get().spotifyGetPlaybackInfo(token, 0);
-                        m_pollingCooldown = 4;
-                    }
-                }
-            });
+            pbm.fetchPlayer();
         }
     }
 
     void onExit() override {
         this->show(false);
-        m_titleListener.destroy();
-        m_artistListener.destroy();
+        m_nowPlayingListener.destroy();
+        m_imageListener.destroy();
         m_playbackListener.destroy();
-        if (m_pollingTask.isValid()) m_pollingTask.abort();
+        pbm.stopPolling();
+        this->unscheduleUpdate();
         CCLayer::onExit();
     }
 
+    /// @brief Interpolate the progress from the last sample, responses correct it through the snapshot.
+    void update(float dt) override {
+        if (!m_progressBar) return;
+
+        auto& np = pbm.getNowPlaying();
+        bool hasDuration = np.durationMs > 0;
+        if (m_progressBar->isVisible() != hasDuration) m_progressBar->setVisible(hasDuration);
+        if (hasDuration) m_progressBar->setProgress(np.getProgressAt(std::chrono::steady_clock::now()), np.durationMs);
+    }
+
 public:
 	static MusicControlOverlay* get() {
 		if (auto existing = OverlayManager::get()->getChildByType<MusicControlOverlay>(0)) {
@@ -349,10 +352,8 @@ public:
             auto artist = pbm.getCurrentSongArtist();
 
             m_musicTitle->setString(title.has_value() ? title->c_str() : "No Song");
-            m_musicTitle->limitLabelWidth(200.f, 1.5, 0.1f);
 
             m_musicArtist->setString(artist.has_value() ? artist->c_str() : "No Artist");
-            m_musicArtist->limitLabelWidth(200.f, 1.2, 0.1f);
             
             pbm.isPlaybackActive([this](bool isPlaying) {
                 auto status = isPlaying;
@@ -368,17 +369,7 @@ public:
         }
         #endif
         if (Mod::get()->getSavedValue<bool>("hasAuthorized") && !pbm.isWindows()) {
-            m_pollingToggle = show;
-            if (m_pollingCooldown == 0) {
-                std::string token = Mod::get()->getSavedValue<std::string>("spotify-token", "");
-                if (token.empty()) {
-                    log::error("No Spotify token available");
-                    return;
-                }
-
-                PlaybackManager::get().spotifyGetPlaybackInfo(token, 0);
-                m_pollingCooldown = 4;
-            }
+            show ? pbm.startPolling() : pbm.stopPolling();
         }
         if (Mod::get()->getSavedValue<bool>("autoEnabled")) {
             m_autoBtn->toggle(true);
@@ -386,18 +377,23 @@ public:
 		this->show(show);
 	}
 
+    /// @brief Only touch the nodes whose fields changed, a poll that returns the same song costs no relayout.
+    void applyNowPlaying(NowPlaying const& np, uint32_t changed) {
+        if ((changed & NowPlaying::Title) && !np.title.empty()) this->updateTitle(np.title);
+        if ((changed & NowPlaying::Artist) && !np.artist.empty()) this->updateArtist(np.artist);
+        if ((changed & NowPlaying::Art) && !pbm.isWindows()) this->updateImageFromUrl(np.artUrl);
+    }
+
     void updateTitle(std::string title) {
         if (!m_musicTitle) return;
 
         m_musicTitle->setString(title.length() != 0 ? title.c_str() : "No Song");
-        m_musicTitle->limitLabelWidth(200.f, 1.5, 0.1f);
     }
 
     void updateArtist(std::string artist) {
         if (!m_musicArtist) return;
 
         m_musicArtist->setString(artist.length() != 0 ? artist.c_str() : "No Artist");
-        m_musicArtist->limitLabelWidth(200.f, 1.2, 0.1f);
     }
 
     void updateImageFromUrl(std::string url) {
@@ -424,6 +420,13 @@ public:
         }
     }
 
+    /// @brief Memory collector for the overlay images (see memory::registerCollector).
+    void collectMemoryStats(std::vector<memory::Usage>& out) const {
+        if (m_musicImage && m_musicImage->getTexture()) {
+            out.push_back({"album art", memory::getTextureBytes(m_musicImage->getTexture()), 1});
+        }
+    }
+
     void togglePlaybackBtn(bool status) {
         if (!m_playbackBtn) return;
 
@@ -2,6 +2,8 @@
 #include "Geode/loader/Log.hpp"
 #include "MusicOverlayManager.cpp"
 #include "httpManager.hpp"
+#include "RequestScheduler.hpp"
+#include "SpotifyPlayerState.hpp"
 
 bool PlaybackManager::isWindows() {
     #ifdef GEODE_IS_WINDOWS
@@ -34,7 +36,6 @@ bool PlaybackManager::getMediaManager() {
     auto attachToSession = [this] {
         if (!m_mediaManager) return;
         if (auto session = m_mediaManager.GetCurrentSession()) {
-            static std::string lastSongName, lastArtistName;
             static GlobalSystemMediaTransportControlsSessionPlaybackStatus lastStatus{};
 
             session.MediaPropertiesChanged([this](auto session, auto) {
@@ -48,8 +49,7 @@ bool PlaybackManager::getMediaManager() {
                     auto thumbnail = props.Thumbnail();
 
                     Loader::get()->queueInMainThread([this, title, artist] {
-                        if (title  != lastSongName)  { lastSongName  = title;  SongUpdateEvent("title-update"_spr).send(title); }
-                        if (artist != lastArtistName) { lastArtistName = artist; SongUpdateEvent("artist-update"_spr).send(artist); }
+                        updateNowPlaying([&](NowPlaying& np) { np.title = title; np.artist = artist; });
                     });
 
                     if (!thumbnail) return;
@@ -83,7 +83,9 @@ bool PlaybackManager::getMediaManager() {
                     auto status = s.GetPlaybackInfo().PlaybackStatus();
                     if (status == lastStatus) return;
                     lastStatus = status;
-                    PlaybackUpdateEvent("playback-update"_spr).send(status == GlobalSystemMediaTransportControlsSessionPlaybackStatus::Playing);
+                    bool playing = status == GlobalSystemMediaTransportControlsSessionPlaybackStatus::Playing;
+                    PlaybackUpdateEvent("playback-update"_spr).send(playing);
+                    updateNowPlaying([&](NowPlaying& np) { np.playing = playing; });
                 });
             });
 
@@ -98,8 +100,7 @@ bool PlaybackManager::getMediaManager() {
                 auto thumbnail = props.Thumbnail();
 
                 Loader::get()->queueInMainThread([this, title, artist] {
-                    if (title  != lastSongName)  { lastSongName  = title;  SongUpdateEvent("title-update"_spr).send(title); }
-                    if (artist != lastArtistName) { lastArtistName = artist; SongUpdateEvent("artist-update"_spr).send(artist); }
+                    updateNowPlaying([&](NowPlaying& np) { np.title = title; np.artist = artist; });
                 });
 
                 if (!thumbnail) return;
@@ -130,7 +131,9 @@ bool PlaybackManager::getMediaManager() {
                 auto status = session.GetPlaybackInfo().PlaybackStatus();
                 if (status == lastStatus) return;
                 lastStatus = status;
-                PlaybackUpdateEvent("playback-update"_spr).send(status == GlobalSystemMediaTransportControlsSessionPlaybackStatus::Playing);
+                bool playing = status == GlobalSystemMediaTransportControlsSessionPlaybackStatus::Playing;
+                PlaybackUpdateEvent("playback-update"_spr).send(playing);
+                updateNowPlaying([&](NowPlaying& np) { np.playing = playing; });
             });
         }
     };
@@ -182,9 +185,7 @@ void PlaybackManager::isPlaybackActive(std::function<void(bool)> callback) {
     if (!isWindows()) {
         if (!Mod::get()->getSavedValue<bool>("hasAuthorized")) {callback(false); return; }
 
-        std::string token = Mod::get()->getSavedValue<std::string>("spotify-token", "");
-        if (token.empty()) { callback(false); return; }
-        spotifyisPlaybackActive(token, [callback](bool isPlaying) { callback(isPlaying); });
+        fetchPlayer(std::move(callback));
     } else {
         #ifdef GEODE_IS_WINDOWS
         auto session = m_mediaManager.GetCurrentSession();
@@ -203,7 +204,14 @@ bool PlaybackManager::control(bool play) {
 
         std::string token = Mod::get()->getSavedValue<std::string>("spotify-token", "");
         if (token.empty()) { return false; }
-        PlaybackManager::get().spotifyControlRequest(token, 0, play);
+
+        // hooks often fire several times within a few frames, only the last intent is sent
+        m_desiredPlaying = play;
+        if (m_controlTimer.isValid()) m_controlTimer.abort();
+        m_controlTimer = async::spawn(
+            arc::sleep(CONTROL_DEBOUNCE),
+            [this] { Loader::get()->queueInMainThread([this] { this->flushControl(); }); }
+        );
         return true;
     } else {
         #ifdef GEODE_IS_WINDOWS
@@ -241,11 +249,24 @@ bool PlaybackManager::toggleControl() {
 
         std::string token = Mod::get()->getSavedValue<std::string>("spotify-token", "");
         if (token.empty()) { return false; }
-        spotifyisPlaybackActive(token, [](bool isPlaying) {
+
+        // the player's choice wins over game hooks still waiting to be sent
+        m_desiredPlaying.reset();
+        if (m_controlTimer.isValid()) m_controlTimer.abort();
+
+        if (m_playbackState.isFresh()) {
+            // assume the toggle lands, so a second press before the response toggles back
+            bool play = !*m_playbackState.playing;
+            m_playbackState.playing = play;
+            spotifyControlRequest(token, 0, play, RequestPriority::UserControl);
+            return true;
+        }
+
+        fetchPlayer([](bool isPlaying) {
             std::string token = Mod::get()->getSavedValue<std::string>("spotify-token", "");
             if (token.empty()) return; 
-            PlaybackManager::get().spotifyControlRequest(token, 0, !isPlaying);
-        });
+            PlaybackManager::get().spotifyControlRequest(token, 0, !isPlaying, RequestPriority::UserControl);
+        }, RequestPriority::UserControl);
         return true;
     } else {
         #ifdef GEODE_IS_WINDOWS
@@ -258,6 +279,119 @@ bool PlaybackManager::toggleControl() {
     }
 }
 
+void PlaybackManager::confirmPlayback(bool playing) {
+    m_playbackState.playing = playing;
+    m_playbackState.confirmedAt = std::chrono::steady_clock::now();
+    PlaybackUpdateEvent("playback-update"_spr).send(playing);
+    updateNowPlaying([&](NowPlaying& np) {
+        if (np.playing == playing) return;
+        // restart the interpolation from where playback stopped or resumed
+        auto now = std::chrono::steady_clock::now();
+        np.progressMs = np.getProgressAt(now);
+        np.sampledAt = now;
+        np.playing = playing;
+    });
+}
+
+void PlaybackManager::updateNowPlaying(std::function<void(NowPlaying&)> const& update) {
+    auto next = m_nowPlaying;
+    update(next);
+
+    // the sample time is kept even when nothing else changed
+    auto changed = next.diff(m_nowPlaying);
+    if (changed) next.version = m_nowPlaying.version + 1;
+    m_nowPlaying = std::move(next);
+    if (!changed) return;
+
+    if (changed & (NowPlaying::TrackID | NowPlaying::State)) {
+        if (m_nowPlaying.playing) m_idlePolls = 0;
+        // the predicted end of the track moved
+        schedulePoll(nextPollDelay());
+    }
+    NowPlayingUpdateEvent("now-playing-update"_spr).send(m_nowPlaying, changed);
+}
+
+void PlaybackManager::startPolling() {
+    if (isWindows() || m_polling) return;
+    m_polling = true;
+    m_idlePolls = 0;
+    // showing and hiding the overlay quickly doesn't send a poll every time
+    auto sinceLast = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_lastPollAt);
+    schedulePoll(std::max(POLL_MIN_INTERVAL - sinceLast, std::chrono::milliseconds(0)));
+}
+
+void PlaybackManager::stopPolling() {
+    m_polling = false;
+    m_nextPollAt.reset();
+    if (m_pollTimer.isValid()) m_pollTimer.abort();
+}
+
+void PlaybackManager::pollAfterAction() {
+    m_idlePolls = 0;
+    schedulePoll(POLL_AFTER_ACTION);
+}
+
+void PlaybackManager::schedulePoll(std::chrono::milliseconds delay) {
+    if (!m_polling) return;
+
+    auto at = std::chrono::steady_clock::now() + delay;
+    if (m_nextPollAt && *m_nextPollAt <= at) return;
+    m_nextPollAt = at;
+
+    if (m_pollTimer.isValid()) m_pollTimer.abort();
+    m_pollTimer = async::spawn(
+        arc::sleep(asp::Duration::fromMillis(delay.count())),
+        [this] { Loader::get()->queueInMainThread([this] { this->pollNow(); }); }
+    );
+}
+
+void PlaybackManager::pollNow() {
+    m_nextPollAt.reset();
+    if (!m_polling) return;
+
+    if (!Mod::get()->getSavedValue<bool>("hasAuthorized")) return stopPolling();
+    if (Mod::get()->getSavedValue<std::string>("spotify-token", "").empty()) {
+        log::error("No Spotify token available");
+        return stopPolling();
+    }
+
+    if (!m_nowPlaying.playing) ++m_idlePolls;
+    m_lastPollAt = std::chrono::steady_clock::now();
+    // scheduled on purpose, so never answered from the last response
+    fetchPlayer(nullptr, RequestPriority::MetadataPoll, std::chrono::milliseconds(0));
+
+    // also covers responses that never arrive (rate limits, network errors), a response
+    // that changes the track or the playback state reschedules from the new data
+    schedulePoll(nextPollDelay());
+}
+
+std::chrono::milliseconds PlaybackManager::nextPollDelay() const {
+    using namespace std::chrono;
+
+    if (!m_nowPlaying.playing || m_nowPlaying.durationMs <= 0) {
+        auto backoff = POLL_IDLE_BASE * (1 << std::clamp(m_idlePolls - 1, 0, 4));
+        return std::min<milliseconds>(backoff, POLL_IDLE_MAX);
+    }
+
+    auto remaining = milliseconds(m_nowPlaying.durationMs - m_nowPlaying.getProgressAt(steady_clock::now()));
+    return std::clamp<milliseconds>(remaining + POLL_TRACK_END_GRACE, POLL_MIN_INTERVAL, POLL_MAX_PLAYING_INTERVAL);
+}
+
+void PlaybackManager::flushControl() {
+    if (!m_desiredPlaying) return;
+    bool play = *m_desiredPlaying;
+    m_desiredPlaying.reset();
+
+    if (m_playbackState.isFresh() && m_playbackState.playing == play) {
+        log::debug("Playback already {}, skipping request", play ? "playing" : "paused");
+        return;
+    }
+
+    std::string token = Mod::get()->getSavedValue<std::string>("spotify-token", "");
+    if (token.empty()) return;
+    spotifyControlRequest(token, 0, play);
+}
+
 #ifdef GEODE_IS_WINDOWS
 std::optional<std::string> PlaybackManager::getCurrentSongTitle() {
     try {
@@ -332,9 +466,20 @@ void PlaybackManager::getCurrentSongThumbnail(std::function<void(std::vector<uin
 }
 #endif
 
-void PlaybackManager::spotifyControlRequest(std::string token, int retryCount, bool play) {
+void PlaybackManager::spotifyControlRequest(std::string token, int retryCount, bool play, RequestPriority priority) {
     if (retryCount > 1 || Mod::get()->getSavedValue<bool>("isRateLimited")) {
         log::error("Max retries reached for control request");
+        // an optimistic toggle may have assumed this request would land
+        m_playbackState.invalidate();
+        if (retryCount > 0) finishControlRequest();
+        return;
+    }
+
+    // a game hook never overrides a command from the player that is still in flight,
+    // its intent is sent once that one is answered, if the result doesn't match it already
+    if (m_controlPending && priority < m_controlPriority) {
+        log::debug("Player command pending, deferring {} request", play ? "play" : "pause");
+        m_desiredPlaying = play;
         return;
     }
     
@@ -344,90 +489,50 @@ void PlaybackManager::spotifyControlRequest(std::string token, int retryCount, b
     req.bodyString("");
     RateLimitUpdate("rate-limit-update"_spr).send();
 
-    m_listener.spawn(
-        req.put(
-            play ? "https://api.spotify.com/v1/me/player/play"
-                : "https://api.spotify.com/v1/me/player/pause",
-            geode::getMod()
-        ),
-        [this, retryCount, play, token](web::WebResponse value) {
+    // a newer command of the same or higher priority supersedes one still in flight
+    m_controlRequest.cancel();
+    m_controlPriority = priority;
+    m_controlPending = true;
+    m_controlRequest = RequestScheduler::get().enqueue({
+        .method = RequestMethod::Put,
+        .url = play ? "https://api.spotify.com/v1/me/player/play" : "https://api.spotify.com/v1/me/player/pause",
+        .request = std::move(req),
+        .priority = priority,
+        .callback = [this, retryCount, play, priority, token](web::WebResponse value) {
             auto code = value.code();
 
             if (code == 401) {
                 log::debug("Token expired, refreshing... (attempt {})", retryCount + 1);
-                SpotifyAuth::get()->refresh([this, retryCount, play](std::string newToken) {
+                SpotifyAuth::get()->refresh([this, retryCount, play, priority](std::string newToken) {
+                    if (newToken.empty()) return finishControlRequest();
                     log::debug("Token refreshed, retrying request");
-                    spotifyControlRequest(newToken, retryCount + 1, play);
-                });
+                    spotifyControlRequest(newToken, retryCount + 1, play, priority);
+                }, token);
                 return;
             }
             
-            if (code == 500) { Mod::get()->setSavedValue<bool>("hasAuthorized", false); return; }
-            if (code == 404) { log::debug("No active device"); return; }
+            if (code == 500) { Mod::get()->setSavedValue<bool>("hasAuthorized", false); return finishControlRequest(); }
+            if (code == 404) { log::debug("No active device"); m_playbackState.invalidate(); return finishControlRequest(); }
             
             if (value.ok()) {
-                PlaybackUpdateEvent("playback-update"_spr).send(play);
+                confirmPlayback(play);
+                pollAfterAction();
                 log::debug("Successfully {} playback", play ? "started" : "paused");
-                return;
+                return finishControlRequest();
             }
             
             log::error("Request failed with code: {} {}", code, value.string());
             log::error("Token: {}", token);
-        }
-    );
+            m_playbackState.invalidate();
+            finishControlRequest();
+        },
+    });
 }
 
-void PlaybackManager::spotifyisPlaybackActive(std::string token, std::function<void(bool)> callback, int retryCount) {
-    if (retryCount > 1 || Mod::get()->getSavedValue<bool>("isRateLimited")) {
-        log::error("Max retries reached for playback info request");
-        return callback(false);
-    }
-    
-    auto req = web::WebRequest();
-    req.header("Authorization", fmt::format("Bearer {}", token));
-    RateLimitUpdate("rate-limit-update"_spr).send();
-    
-    m_listener.spawn(
-        req.get("https://api.spotify.com/v1/me/player"),
-        [this, retryCount, callback, token](web::WebResponse value) {
-            auto code = value.code();
-            
-            if (code == 401) {
-                log::debug("Token expired, refreshing... (attempt {})", retryCount + 1);
-                SpotifyAuth::get()->refresh([this, retryCount, callback](std::string newToken) {
-                    log::debug("Token refreshed, retrying request");
-                    spotifyisPlaybackActive(newToken, callback, retryCount + 1);
-                });
-                return;
-            }
-            
-            if (code == 500) { Mod::get()->setSavedValue<bool>("hasAuthorized", false); return; }
-            if (code == 204) { log::debug("No active device"); return; }
-            
-            if (value.ok()) {
-                auto jsonResult = value.json();
-                if (!jsonResult.isOk()) {
-                    log::error("Failed to parse JSON response");
-                    log::error("Code: {}, Body: {}", code, value.string());
-                    callback(false);
-                    return;
-                }
-                auto jsonUnwrap = jsonResult.unwrap();
-                if (!jsonUnwrap.contains("is_playing")) {
-                    log::error("No is_playing field in response!");
-                    log::error("Code: {}, Body: {}", code, value.string());
-                    callback(false);
-                    return;
-                }
-                callback(jsonUnwrap["is_playing"].asBool().unwrap());
-                return;
-            }
-            
-            log::error("Request failed with code: {} {}", code, value.string());
-            log::error("Token: {}", token);
-            callback(false);
-        }
-    );
+void PlaybackManager::finishControlRequest() {
+    m_controlPending = false;
+    // hook intents deferred while the command was in flight
+    flushControl();
 }
 
 void PlaybackManager::spotifySkipRequest(std::string token, int retryCount, bool direction) {
@@ -442,21 +547,21 @@ void PlaybackManager::spotifySkipRequest(std::string token, int retryCount, bool
     req.bodyString("");
     RateLimitUpdate("rate-limit-update"_spr).send();
     
-    m_listener.spawn(
-        req.post(
-            direction ? "https://api.spotify.com/v1/me/player/next"
-                : "https://api.spotify.com/v1/me/player/previous",
-            geode::getMod()
-        ),
-        [this, retryCount, direction, token](web::WebResponse value) {
+    RequestScheduler::get().enqueue({
+        .method = RequestMethod::Post,
+        .url = direction ? "https://api.spotify.com/v1/me/player/next" : "https://api.spotify.com/v1/me/player/previous",
+        .request = std::move(req),
+        .priority = RequestPriority::UserControl,
+        .callback = [this, retryCount, direction, token](web::WebResponse value) {
             auto code = value.code();
             
             if (code == 401) {
                 log::debug("Token expired, refreshing... (attempt {})", retryCount + 1);
                 SpotifyAuth::get()->refresh([this, retryCount, direction](std::string newToken) {
+                    if (newToken.empty()) return;
                     log::debug("Token refreshed, retrying request");
                     spotifySkipRequest(newToken, retryCount + 1, direction);
-                });
+                }, token);
                 return;
             }
             
@@ -464,115 +569,145 @@ void PlaybackManager::spotifySkipRequest(std::string token, int retryCount, bool
             if (code == 404) { log::debug("No active device"); return; }
             
             if (value.ok()) {
+                pollAfterAction();
                 log::debug("Successfully skipped track: {}", direction ? "next" : "previous");
                 return;
             }
             
             log::error("Request failed with code: {} {}", code, value.string());
             log::error("Token: {}", token);
+        },
+    });
+}
+
+void PlaybackManager::fetchPlayer(std::function<void(bool)> callback, RequestPriority priority, std::chrono::milliseconds maxAge) {
+    auto now = std::chrono::steady_clock::now();
+    if (m_playbackState.playing && now - m_playerFetchedAt < maxAge) {
+        if (callback) callback(*m_playbackState.playing);
+        return;
+    }
+    if (callback) m_playerWaiters.push_back(std::move(callback));
+
+    if (m_playerFetching) {
+        if (now - m_playerFetchStartedAt < PLAYER_FETCH_TIMEOUT) {
+            // a command waiting for the state shouldn't queue behind polls
+            if (priority <= m_playerPriority || m_playerRequest.isDone()) return;
+        } else {
+            // never answered, e.g. a token refresh that didn't call back. the waiters go to the new request
+            log::warn("Player request timed out, sending a new one");
         }
-    );
+        m_playerRequest.cancel();
+    }
+
+    std::string token = Mod::get()->getSavedValue<std::string>("spotify-token", "");
+    if (!Mod::get()->getSavedValue<bool>("hasAuthorized") || token.empty()) return finishPlayerFetch(false);
+
+    m_playerFetching = true;
+    m_playerFetchStartedAt = now;
+    ++m_playerFetchId;
+    spotifyFetchPlayer(token, 0, priority);
+}
+
+void PlaybackManager::finishPlayerFetch(bool playing) {
+    m_playerFetching = false;
+    auto waiters = std::move(m_playerWaiters);
+    m_playerWaiters.clear();
+    for (auto& waiter : waiters) waiter(playing);
 }
 
-void PlaybackManager::spotifyGetPlaybackInfo(std::string token, int retryCount) {
+void PlaybackManager::spotifyFetchPlayer(std::string token, int retryCount, RequestPriority priority) {
     if (retryCount > 1 || Mod::get()->getSavedValue<bool>("isRateLimited")) {
-        log::error("Max retries reached for playback info request");
-        return;
+        log::error("Max retries reached for player request");
+        return finishPlayerFetch(false);
     }
     
     auto req = web::WebRequest();
     req.header("Authorization", fmt::format("Bearer {}", token));
     RateLimitUpdate("rate-limit-update"_spr).send();
     
-    m_listener.spawn(
-        req.get("https://api.spotify.com/v1/me/player/currently-playing", geode::getMod()),
-        [this, retryCount, token](web::WebResponse value) {
+    m_playerPriority = priority;
+    m_playerRequest = RequestScheduler::get().enqueue({
+        .method = RequestMethod::Get,
+        .url = fmt::format("https://api.spotify.com/v1/me/player?{}", SpotifyPlayerState::QUERY),
+        .request = std::move(req),
+        .priority = priority,
+        .callback = [this, retryCount, priority, token](web::WebResponse value) {
             auto code = value.code();
             
             if (code == 401) {
                 log::debug("Token expired, refreshing... (attempt {})", retryCount + 1);
-                SpotifyAuth::get()->refresh([this, retryCount](std::string newToken) {
+                SpotifyAuth::get()->refresh([this, retryCount, priority, fetchId = m_playerFetchId](std::string newToken) {
+                    // the fetch timed out while refreshing, a newer one owns the waiters
+                    if (fetchId != m_playerFetchId) return;
+                    if (newToken.empty()) return finishPlayerFetch(false);
                     log::debug("Token refreshed, retrying request");
-                    spotifyGetPlaybackInfo(newToken, retryCount + 1);
-                });
+                    spotifyFetchPlayer(newToken, retryCount + 1, priority);
+                }, token);
                 return;
             }
             
-            if (code == 500) { Mod::get()->setSavedValue<bool>("hasAuthorized", false); return; }
-            if (code == 204) { log::debug("No active device"); return; }
+            if (code == 500) {
+                Mod::get()->setSavedValue<bool>("hasAuthorized", false);
+                return finishPlayerFetch(false);
+            }
+            if (code == 204) {
+                log::debug("No active device");
+                m_playbackState.invalidate();
+                updateNowPlaying([](NowPlaying& np) { np.playing = false; np.device.clear(); });
+                return finishPlayerFetch(false);
+            }
             
             if (!value.ok()) {
-                log::error("Playback request failed: {} {}", code, value.string());
-                return;
+                log::error("Player request failed: {} {}", code, value.string());
+                return finishPlayerFetch(false);
             }
             
-            auto jsonResult = value.json();
-            if (!jsonResult.isOk()) {
-                log::error("Failed to parse playback JSON");
+            auto& body = value.data();
+            auto parsed = SpotifyPlayerState::parse(std::string_view(reinterpret_cast<const char*>(body.data()), body.size()));
+            if (parsed.isErr()) {
+                log::error("Failed to parse player JSON: {}", parsed.unwrapErr());
                 log::error("Code: {}, Body: {}", code, value.string());
-                return;
+                return finishPlayerFetch(false);
             }
             
-            auto root = jsonResult.unwrap();
-            if (!root.contains("currently_playing_type") ||
-                root["currently_playing_type"].asString().unwrapOr("") != "track") {
+            auto player = parsed.unwrap();
+            bool isPlaying = player.isPlaying.value_or(false);
+            m_playerFetchedAt = std::chrono::steady_clock::now();
+            confirmPlayback(isPlaying);
+            updateNowPlaying([&](NowPlaying& np) { np.device = player.device.value_or(""); });
+            // the waiters only need the playback state, the rest fills the now playing snapshot
+            finishPlayerFetch(isPlaying);
+
+            if (player.playingType != "track") {
                 log::debug("Nothing playable right now");
                 return;
             }
-            
-            if (root.contains("is_playing")) {
-                PlaybackUpdateEvent("playback-update"_spr).send(root["is_playing"].asBool().unwrapOr(false));
-            }
-            
-            if (!root.contains("item")) {
-                log::error("Playback response missing item");
-                return;
-            }
-            
-            auto item = root["item"];
-            if (item.isNull() || !item.isObject()) {
+            if (!player.trackID) {
                 log::debug("Item is null, probably an ad or unsupported content");
                 return;
             }
-            
-            auto titleOpt = item["name"].asString();
-            if (!titleOpt.isOk()) {
+            if (!player.title) {
                 log::error("Track missing name");
                 return;
             }
-            
-            auto artists = item["artists"].asArray();
-            if (!artists.isOk() || artists.unwrap().empty()) {
-                log::error("Track missing artists");
-                return;
-            }
-            
-            auto artistOpt = artists.unwrap()[0]["name"].asString();
-            if (!artistOpt.isOk()) {
-                log::error("Artist missing name");
+            if (!player.artist) {
+                log::error("Track missing artist");
                 return;
             }
-            
-            auto cover = item["album"]["images"].asArray();
-            if (!cover.isOk() || cover.unwrap().empty()) {
+            if (!player.artUrl) {
                 log::error("Track missing cover");
                 return;
             }
             
-            auto coverOpt = cover.unwrap()[0]["url"].asString();
-            if (!coverOpt.isOk()) {
-                log::error("Cover missing URL");
-                return;
-            }
-            
-            auto title = titleOpt.unwrap();
-            auto artist = artistOpt.unwrap();
-            auto thumbnail = coverOpt.unwrap();
-            Loader::get()->queueInMainThread([title, artist, thumbnail] {
-                SongUpdateEvent("title-update"_spr).send(title);
-                SongUpdateEvent("artist-update"_spr).send(artist);
-                SongUpdateEvent("image-update"_spr).send(thumbnail);
+            updateNowPlaying([&](NowPlaying& np) {
+                np.trackID = *player.trackID;
+                np.title = *player.title;
+                np.artist = *player.artist;
+                np.artUrl = *player.artUrl;
+                np.progressMs = static_cast<int>(player.progressMs.value_or(0));
+                np.durationMs = static_cast<int>(player.durationMs.value_or(0));
+                np.sampledAt = std::chrono::steady_clock::now();
             });
-        }
-    );
+        },
+    });
 }
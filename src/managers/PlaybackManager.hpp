@@ -7,6 +7,10 @@
 #include <winrt/Windows.Storage.Streams.h>
 #endif
 #include "Geode/loader/Event.hpp"
+#include "RequestScheduler.hpp"
+#include <arc/time/Sleep.hpp>
+#include <algorithm>
+#include <chrono>
 
 #define WINRT_CPPWINRT
 
@@ -17,13 +21,117 @@ using namespace Windows::Foundation;
 using namespace Windows::Media::Control;
 #endif
 
+/// @brief Everything the overlay shows about the current track. Updated as a whole through
+/// PlaybackManager::updateNowPlaying, which only notifies listeners about fields that actually changed.
+struct NowPlaying {
+    enum Field : uint32_t {
+        TrackID  = 1 << 0,
+        Title    = 1 << 1,
+        Artist   = 1 << 2,
+        Art      = 1 << 3,
+        State    = 1 << 4,
+        Progress = 1 << 5,
+        Device   = 1 << 6,
+    };
+
+    std::string trackID;
+    std::string title;
+    std::string artist;
+    std::string artUrl;     // album art (Spotify only, Windows sends the image data through ThumbnailUpdateEvent)
+    bool playing = false;
+    int progressMs = 0;
+    int durationMs = 0;
+    std::string device;     // name of the active Spotify device
+    std::chrono::steady_clock::time_point sampledAt; // when progressMs was reported
+    uint64_t version = 0;   // incremented on every change
+
+    /// @brief Progress interpolated from the last sample, assuming playback went on at normal speed since.
+    int getProgressAt(std::chrono::steady_clock::time_point now) const {
+        if (!playing || durationMs <= 0) return progressMs;
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - sampledAt).count();
+        return static_cast<int>(std::clamp<int64_t>(progressMs + elapsed, 0, durationMs));
+    }
+
+    /// @brief Fields that differ from the other snapshot (version and sample time excluded).
+    uint32_t diff(NowPlaying const& other) const {
+        uint32_t changed = 0;
+        if (trackID != other.trackID) changed |= TrackID;
+        if (title != other.title) changed |= Title;
+        if (artist != other.artist) changed |= Artist;
+        if (artUrl != other.artUrl) changed |= Art;
+        if (playing != other.playing) changed |= State;
+        if (progressMs != other.progressMs || durationMs != other.durationMs) changed |= Progress;
+        if (device != other.device) changed |= Device;
+        return changed;
+    }
+};
+
 class PlaybackManager {
+public:
+    /// @brief Spotify playback state as last reported by a response (or accepted command).
+    struct PlaybackState {
+        /// @brief Older states are re-read before being acted on, the player may have used another device since.
+        static constexpr auto MAX_AGE = std::chrono::seconds(15);
+
+        std::optional<bool> playing;
+        std::chrono::steady_clock::time_point confirmedAt;
+
+        bool isFresh() const {
+            return playing.has_value() && std::chrono::steady_clock::now() - confirmedAt < MAX_AGE;
+        }
+        void invalidate() { playing.reset(); }
+    };
+
 protected:
     PlaybackManager() = default;
-    async::TaskHolder<web::WebResponse> m_listener;
-    void spotifyControlRequest(std::string token, int retryCount = 0, bool play = true);
-    void spotifyisPlaybackActive(std::string token, std::function<void(bool)> callback,int retryCount = 0);
+    void spotifyControlRequest(std::string token, int retryCount = 0, bool play = true, RequestPriority priority = RequestPriority::AutoPause);
+    void spotifyFetchPlayer(std::string token, int retryCount, RequestPriority priority);
     void spotifySkipRequest(std::string token, int retryCount = 0, bool direction = true);
+
+    /// @brief Play/pause requests from game hooks within this window collapse into the last one.
+    static constexpr auto CONTROL_DEBOUNCE = asp::Duration::fromMillis(150);
+    std::optional<bool> m_desiredPlaying; // latest hook intent, waiting for the debounce window or a pending player command
+    arc::TaskHandle<void> m_controlTimer;
+    RequestHandle m_controlRequest;
+    RequestPriority m_controlPriority = RequestPriority::MetadataPoll; // of m_controlRequest
+    bool m_controlPending = false; // m_controlRequest or its token refresh hasn't finished yet
+    PlaybackState m_playbackState;
+    NowPlaying m_nowPlaying;
+    /// @brief Send the pending intent, unless Spotify is already in that state.
+    void flushControl();
+    /// @brief The control request finished (answered, failed or given up), send the intents deferred meanwhile.
+    void finishControlRequest();
+
+    // One /v1/me/player request at a time, shared by everything that needs the player state.
+    static constexpr auto PLAYER_MAX_AGE = std::chrono::milliseconds(2000);
+    /// @brief A fetch still unanswered after this long is sent again instead of joined.
+    static constexpr auto PLAYER_FETCH_TIMEOUT = std::chrono::seconds(15);
+    bool m_playerFetching = false;
+    std::chrono::steady_clock::time_point m_playerFetchStartedAt;
+    uint32_t m_playerFetchId = 0; // tells a timed out fetch from the one that replaced it
+    RequestPriority m_playerPriority = RequestPriority::MetadataPoll;
+    RequestHandle m_playerRequest;
+    std::vector<std::function<void(bool)>> m_playerWaiters;
+    std::chrono::steady_clock::time_point m_playerFetchedAt;
+    void finishPlayerFetch(bool playing);
+
+    // Metadata polling: right after the predicted end of the track while playing,
+    // at exponentially growing intervals while paused or idle.
+    static constexpr auto POLL_MIN_INTERVAL = std::chrono::milliseconds(1000);
+    static constexpr auto POLL_MAX_PLAYING_INTERVAL = std::chrono::seconds(15); // picks up changes made on other devices
+    static constexpr auto POLL_TRACK_END_GRACE = std::chrono::milliseconds(750);
+    static constexpr auto POLL_AFTER_ACTION = std::chrono::milliseconds(750);
+    static constexpr auto POLL_IDLE_BASE = std::chrono::seconds(5);
+    static constexpr auto POLL_IDLE_MAX = std::chrono::seconds(60);
+    bool m_polling = false;
+    int m_idlePolls = 0; // polls sent since playback was last seen (or a user action)
+    arc::TaskHandle<void> m_pollTimer;
+    std::optional<std::chrono::steady_clock::time_point> m_nextPollAt;
+    std::chrono::steady_clock::time_point m_lastPollAt;
+    /// @brief Poll after the delay, unless a poll is already due sooner.
+    void schedulePoll(std::chrono::milliseconds delay);
+    void pollNow();
+    [[nodiscard]] std::chrono::milliseconds nextPollDelay() const;
 public:
     #ifdef GEODE_IS_WINDOWS
     GlobalSystemMediaTransportControlsSessionManager m_mediaManager = nullptr;
@@ -38,12 +146,34 @@ public:
     std::optional<std::string> getCurrentSongTitle();
     std::optional<std::string> getCurrentSongArtist();
     void getCurrentSongThumbnail(std::function<void(std::vector<uint8_t>)> callback);
-    void spotifyGetPlaybackInfo(std::string token, int retryCount = 0);
+    /// @brief Fetch the Spotify player state (playback state, track, progress and device) into the playback state
+    /// and the now playing snapshot. Answers from the last response if it is younger than maxAge, and joins
+    /// a request already in flight (raising its priority if needed). The callback gets whether Spotify is playing.
+    void fetchPlayer(
+        std::function<void(bool)> callback = nullptr,
+        RequestPriority priority = RequestPriority::MetadataPoll,
+        std::chrono::milliseconds maxAge = PLAYER_MAX_AGE
+    );
+    /// @brief Keep the now playing snapshot up to date while the overlay is shown (Spotify only).
+    void startPolling();
+    void stopPolling();
+    /// @brief Poll shortly, the result of a user action shows up in the next response.
+    void pollAfterAction();
 
     bool m_immune = false;
     bool m_active = false;
 
-    struct SongUpdateEvent : Event<SongUpdateEvent, bool(std::string), std::string> {
+    [[nodiscard]] PlaybackState const& getPlaybackState() const { return m_playbackState; }
+    /// @brief Record a state reported by Spotify and notify listeners (PlaybackUpdateEvent).
+    void confirmPlayback(bool playing);
+
+    [[nodiscard]] NowPlaying const& getNowPlaying() const { return m_nowPlaying; }
+    /// @brief Apply a (partial) update to the now playing snapshot. Sends NowPlayingUpdateEvent if anything changed.
+    /// Must be called from the main thread.
+    void updateNowPlaying(std::function<void(NowPlaying&)> const& update);
+
+    /// @brief Sent with the new snapshot and a mask of the changed NowPlaying::Field values.
+    struct NowPlayingUpdateEvent : Event<NowPlayingUpdateEvent, bool(NowPlaying, uint32_t), std::string> {
         using Event::Event;
     };
     struct ThumbnailUpdateEvent : Event<ThumbnailUpdateEvent, bool(std::vector<uint8_t>), std::string> {
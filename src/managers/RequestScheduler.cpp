@@ -0,0 +1,91 @@
+#include "RequestScheduler.hpp"
+
+#include <algorithm>
+
+void RequestHandle::cancel() {
+    if (m_id) RequestScheduler::get().cancel(m_id);
+}
+
+bool RequestHandle::isDone() const {
+    return !m_id || RequestScheduler::get().isDone(m_id);
+}
+
+RequestHandle RequestScheduler::enqueue(Request request) {
+    auto id = m_nextID++;
+
+    if (this->canSend(request.priority)) {
+        this->send(id, std::move(request));
+        return RequestHandle(id);
+    }
+
+    // behind everything of the same or higher priority
+    auto it = std::find_if(m_queue.begin(), m_queue.end(), [&](Pending const& pending) {
+        return pending.request.priority < request.priority;
+    });
+    m_queue.insert(it, Pending{id, std::move(request)});
+    return RequestHandle(id);
+}
+
+void RequestScheduler::cancel(uint64_t id) {
+    if (auto it = m_inFlight.find(id); it != m_inFlight.end()) {
+        it->second.task.abort();
+        m_inFlight.erase(it);
+        this->startQueued();
+        return;
+    }
+    std::erase_if(m_queue, [&](Pending const& pending) { return pending.id == id; });
+}
+
+bool RequestScheduler::isDone(uint64_t id) const {
+    if (m_inFlight.contains(id)) return false;
+    return std::none_of(m_queue.begin(), m_queue.end(), [&](Pending const& pending) { return pending.id == id; });
+}
+
+void RequestScheduler::send(uint64_t id, Request request) {
+    auto onResponse = [this, id, callback = std::move(request.callback)](web::WebResponse value) {
+        Loader::get()->queueInMainThread([this, id, callback, value = std::move(value)] {
+            this->complete(id, callback, value);
+        });
+    };
+
+    auto& req = request.request;
+    arc::TaskHandle<void> task;
+    switch (request.method) {
+        case RequestMethod::Get: task = async::spawn(req.get(request.url, geode::getMod()), std::move(onResponse)); break;
+        case RequestMethod::Put: task = async::spawn(req.put(request.url, geode::getMod()), std::move(onResponse)); break;
+        case RequestMethod::Post: task = async::spawn(req.post(request.url, geode::getMod()), std::move(onResponse)); break;
+    }
+    m_inFlight.emplace(id, InFlight{request.priority, std::move(task)});
+}
+
+void RequestScheduler::complete(uint64_t id, Callback const& callback, web::WebResponse response) {
+    // cancelled after the response arrived, but before the main thread got to it
+    if (!m_inFlight.erase(id)) return;
+
+    this->startQueued();
+    if (callback) callback(std::move(response));
+}
+
+bool RequestScheduler::canSend(RequestPriority priority) const {
+    if (m_inFlight.size() >= MAX_IN_FLIGHT) return false;
+    if (priority != RequestPriority::MetadataPoll) return true;
+
+    // a second poll would only return the same data, and would hold a slot commands may need
+    return std::none_of(m_inFlight.begin(), m_inFlight.end(), [](auto const& entry) {
+        return entry.second.priority == RequestPriority::MetadataPoll;
+    });
+}
+
+void RequestScheduler::startQueued() {
+    for (auto it = m_queue.begin(); it != m_queue.end();) {
+        if (!this->canSend(it->request.priority)) {
+            ++it;
+            continue;
+        }
+
+        auto pending = std::move(*it);
+        m_queue.erase(it);
+        this->send(pending.id, std::move(pending.request));
+        it = m_queue.begin();
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include <Geode/Geode.hpp>
+#include <Geode/utils/web.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+using namespace geode::prelude;
+
+/// @brief Priority classes of Spotify requests. When more requests are waiting than can be in flight,
+/// higher classes are sent first.
+enum class RequestPriority {
+    MetadataPoll,   // overlay refreshes, cheap to repeat later
+    AutoPause,      // play/pause following the game music
+    UserControl,    // buttons pressed by the player
+};
+
+enum class RequestMethod {
+    Get,
+    Put,
+    Post,
+};
+
+/// @brief Cancellation token of a scheduled request. Cancelling a queued request removes it,
+/// cancelling one in flight aborts it. Either way its callback is never called.
+class RequestHandle {
+public:
+    RequestHandle() = default;
+
+    void cancel();
+    /// @brief Whether the request was cancelled or already completed.
+    [[nodiscard]] bool isDone() const;
+
+protected:
+    friend class RequestScheduler;
+    explicit RequestHandle(uint64_t id) : m_id(id) {}
+
+    uint64_t m_id = 0;
+};
+
+/// @brief Sends Spotify requests with several in flight at once, so a poll never replaces a pending command.
+/// Must be used from the main thread, callbacks are called on the main thread.
+class RequestScheduler {
+public:
+    using Callback = std::function<void(web::WebResponse)>;
+
+    struct Request {
+        RequestMethod method = RequestMethod::Get;
+        std::string url;
+        web::WebRequest request;
+        RequestPriority priority = RequestPriority::MetadataPoll;
+        Callback callback;
+    };
+
+    /// @brief Send the request now if a slot is free, otherwise queue it behind requests of the same or higher priority.
+    /// Only one metadata poll is in flight at a time, the others wait in the queue.
+    RequestHandle enqueue(Request request);
+
+    static RequestScheduler& get() {
+        static RequestScheduler instance;
+        return instance;
+    }
+
+    RequestScheduler(const RequestScheduler&) = delete;
+    RequestScheduler& operator=(const RequestScheduler&) = delete;
+
+protected:
+    RequestScheduler() = default;
+
+    friend class RequestHandle;
+
+    struct Pending {
+        uint64_t id;
+        Request request;
+    };
+
+    struct InFlight {
+        RequestPriority priority;
+        arc::TaskHandle<void> task;
+    };
+
+    static constexpr size_t MAX_IN_FLIGHT = 4;
+
+    [[nodiscard]] bool canSend(RequestPriority priority) const;
+    void cancel(uint64_t id);
+    [[nodiscard]] bool isDone(uint64_t id) const;
+    void send(uint64_t id, Request request);
+    void complete(uint64_t id, Callback const& callback, web::WebResponse response);
+    void startQueued();
+
+    uint64_t m_nextID = 1;
+    std::deque<Pending> m_queue; // sorted by priority, then by arrival
+    std::unordered_map<uint64_t, InFlight> m_inFlight;
+};
@@ -0,0 +1,19 @@
+#include "SpotifyPlayerState.hpp"
+#include "../utils/JsonExtractor.hpp"
+
+geode::Result<SpotifyPlayerState> SpotifyPlayerState::parse(std::string_view json) {
+    SpotifyPlayerState state;
+    auto res = JsonExtractor()
+        .boolean("is_playing", state.isPlaying)
+        .integer("progress_ms", state.progressMs)
+        .string("currently_playing_type", state.playingType)
+        .string("device/name", state.device)
+        .string("item/id", state.trackID)
+        .string("item/name", state.title)
+        .string("item/artists/0/name", state.artist)
+        .string("item/album/images/0/url", state.artUrl)
+        .integer("item/duration_ms", state.durationMs)
+        .extract(json);
+    if (res.isErr()) return geode::Err(res.unwrapErr());
+    return geode::Ok(std::move(state));
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <Geode/Result.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/// @brief The fields of a /v1/me/player response the mod uses. Read with JsonExtractor, so the rest of the payload
+/// (album and artist objects, available markets, context, actions) is skipped instead of parsed into a tree.
+struct SpotifyPlayerState {
+    std::optional<bool> isPlaying;
+    std::optional<int64_t> progressMs;
+    std::optional<std::string> playingType; // "track", "episode", "ad" or "unknown"
+    std::optional<std::string> device;
+    std::optional<std::string> trackID;
+    std::optional<std::string> title;
+    std::optional<std::string> artist;      // first artist
+    std::optional<std::string> artUrl;      // largest album image
+    std::optional<int64_t> durationMs;
+
+    /// @brief Query parameters that shrink the response: with a market, track objects don't list available markets.
+    static constexpr std::string_view QUERY = "market=from_token";
+
+    static geode::Result<SpotifyPlayerState> parse(std::string_view json);
+};
@@ -2,9 +2,57 @@
 #include <Geode/Geode.hpp>
 #include <Geode/utils/web.hpp>
 #include <arc/time/Sleep.hpp>
+#include "../utils/Crypto.hpp"
+
+#include <algorithm>
+#include <cctype>
 
 using namespace geode::prelude;
 
+namespace {
+    /// @brief Percent-encode a value for an application/x-www-form-urlencoded body.
+    std::string formValue(std::string_view value) {
+        std::string out;
+        out.reserve(value.size());
+        for (unsigned char c : value) {
+            if (std::isalnum(c) || c == '-' || c == '.' || c == '_' || c == '~') {
+                out += static_cast<char>(c);
+            } else {
+                out += fmt::format("%{:02X}", c);
+            }
+        }
+        return out;
+    }
+
+    struct TokenResponse {
+        std::string accessToken;
+        std::string refreshToken; // empty if the old one stays valid
+        int64_t expiresIn;
+    };
+
+    Result<TokenResponse> readTokens(web::WebResponse& value) {
+        auto jsonResult = value.json();
+        if (!jsonResult.isOk()) {
+            return Err(fmt::format("Failed to parse JSON response (code {})", value.code()));
+        }
+
+        auto json = jsonResult.unwrap();
+        auto tokenResult = json["access_token"].asString();
+        if (!tokenResult.isOk()) {
+            // error responses look like {"error": "invalid_grant", "error_description": "..."}
+            return Err(fmt::format(
+                "No access_token in response (code {}): {}", value.code(), json["error"].asString().unwrapOr(value.string().unwrapOr(""))
+            ));
+        }
+
+        return Ok(TokenResponse{
+            tokenResult.unwrap(),
+            json["refresh_token"].asString().unwrapOr(""),
+            json["expires_in"].asInt().unwrapOr(3600)
+        });
+    }
+}
+
 SpotifyAuth* SpotifyAuth::instance = nullptr;
 
 void SpotifyAuth::start(std::function<void(std::string)> callback) {
@@ -15,7 +63,13 @@ void SpotifyAuth::start(std::function<void(std::string)> callback) {
         [this] { this->stop(); }
     );
 
-    m_server.start([this](std::string code) {
+    // anything on this machine can reach the redirect port, only the browser coming back from our authorize URL knows the state
+    m_server.start([this, expected = m_state](std::string code, std::string state) {
+        if (expected.empty() || state != expected) {
+            log::warn("Ignoring an authorization redirect with the wrong state");
+            return false;
+        }
+
         queueInMainThread([this, code] {
             Mod::get()->setSavedValue("spotify-code", code);
             
@@ -26,6 +80,7 @@ void SpotifyAuth::start(std::function<void(std::string)> callback) {
                 m_callback(code);
             }
         });
+        return true;
     });
 }
 
@@ -33,50 +88,144 @@ void SpotifyAuth::stop() {
     m_server.stop();
 }
 
-void SpotifyAuth::refresh(std::function<void(std::string)> callback) {
-    auto req = web::WebRequest();
-    m_listener.spawn(
-        req.post("https://craftify.thatgravyboat.tech/api/v1/public/auth?type=refresh&code=" + Mod::get()->getSavedValue<std::string>("spotify-refresh", ""), geode::getMod()),
-        [callback](web::WebResponse value) {
-            auto jsonResult = value.json();
-            if (!jsonResult.isOk()) {
-                log::error("Failed to parse JSON response");
+void SpotifyAuth::authorize() {
+    m_verifier = crypto::randomToken(64);
+    m_state = crypto::randomToken(32);
+    auto challenge = crypto::base64Url(crypto::sha256(m_verifier));
+
+    this->start([this](std::string code) { this->exchangeCode(code); });
+    web::openLinkInBrowser(fmt::format(
+        "https://accounts.spotify.com/authorize?client_id={}&response_type=code&redirect_uri={}&scope={}"
+        "&code_challenge_method=S256&code_challenge={}&state={}",
+        CLIENT_ID, formValue(REDIRECT_URI), formValue(SCOPES), challenge, m_state
+    ));
+}
+
+void SpotifyAuth::exchangeCode(std::string const& code) {
+    auto req = this->tokenRequest(fmt::format(
+        "grant_type=authorization_code&code={}&redirect_uri={}&client_id={}&code_verifier={}",
+        formValue(code), formValue(REDIRECT_URI), CLIENT_ID, m_verifier
+    ));
+
+    m_exchange.spawn(
+        req.post(this->tokenEndpoint(), geode::getMod()),
+        [this](web::WebResponse value) {
+            m_verifier.clear();
+            auto tokens = readTokens(value);
+            if (tokens.isErr()) {
+                log::error("Failed to exchange the authorization code: {}", tokens.unwrapErr());
                 return;
             }
-            
-            auto jsonUnwrap = jsonResult.unwrap();
-            if (!jsonUnwrap.contains("access_token")) {
-                 if (value.code() == 500) {
+
+            auto [accessToken, refreshToken, expiresIn] = tokens.unwrap();
+            if (refreshToken.empty()) {
+                log::error("No refresh_token in the authorization response");
+                return;
+            }
+
+            this->saveTokens(accessToken, refreshToken, expiresIn);
+            Mod::get()->setSavedValue("spotify-pkce", true);
+            Mod::get()->setSavedValue("hasAuthorized", true);
+            log::info("Successfully saved Spotify token");
+        }
+    );
+}
+
+bool SpotifyAuth::hasPkceTokens() const {
+    return Mod::get()->getSavedValue<bool>("spotify-pkce", false);
+}
+
+std::string SpotifyAuth::tokenEndpoint() const {
+    #ifdef DEBUG_BUILD
+    return Mod::get()->getSavedValue<std::string>("spotify-token-endpoint", "https://accounts.spotify.com/api/token");
+    #else
+    return "https://accounts.spotify.com/api/token";
+    #endif
+}
+
+web::WebRequest SpotifyAuth::tokenRequest(std::string const& body) const {
+    auto req = web::WebRequest();
+    req.header("Content-Type", "application/x-www-form-urlencoded");
+    req.bodyString(body);
+    return req;
+}
+
+void SpotifyAuth::refresh(std::function<void(std::string)> callback, std::string const& rejected) {
+    // the request was sent before the last refresh finished
+    auto current = Mod::get()->getSavedValue<std::string>("spotify-token", "");
+    if (!rejected.empty() && current != rejected && this->isTokenFresh()) {
+        if (callback) callback(current);
+        return;
+    }
+
+    if (callback) m_refreshWaiters.push_back(std::move(callback));
+    if (m_refreshing) return;
+    m_refreshing = true;
+
+    auto req = this->tokenRequest(fmt::format(
+        "grant_type=refresh_token&refresh_token={}&client_id={}",
+        formValue(Mod::get()->getSavedValue<std::string>("spotify-refresh", "")), CLIENT_ID
+    ));
+    m_listener.spawn(
+        req.post(this->tokenEndpoint(), geode::getMod()),
+        [this](web::WebResponse value) {
+            auto tokens = readTokens(value);
+            if (tokens.isErr()) {
+                // the refresh token was revoked, or belongs to another client
+                if (value.code() == 400) {
                     log::debug("Authorization revoked");
                     Mod::get()->setSavedValue<bool>("hasAuthorized", false);
-                    return;
+                    return this->finishRefresh("");
                 }
-                log::error("No access_token in response!");
-                log::error("Code: {}, Body: {}", value.code(), value.string());
-                return;
-            }
-            
-            auto tokenResult = jsonUnwrap["access_token"].asString();
-            if (!tokenResult.isOk()) {
-                log::error("Failed to get access_token as string");
-                log::error("Code: {}, Body: {}", value.code(), value.string());
-                return;
+                log::error("Failed to refresh the token: {}", tokens.unwrapErr());
+                return this->finishRefresh("");
             }
 
-            auto refreshResult = jsonUnwrap["refresh_token"].asString();
-            if (refreshResult && refreshResult.isOk()) {
-                std::string refresh = refreshResult.unwrap();
-                Mod::get()->setSavedValue("spotify-refresh", refresh);
-            } else {
-                log::debug("No refresh token in response, not updating stored refresh token");
-            }
-            
-            std::string token = tokenResult.unwrap();
-            Mod::get()->setSavedValue("spotify-token", token);
-            
-            if (callback) {
-                callback(token);
-            }
+            // PKCE refresh tokens rotate, the response carries the one to use next time
+            auto [accessToken, refreshToken, expiresIn] = tokens.unwrap();
+            this->saveTokens(accessToken, refreshToken, expiresIn);
+            this->finishRefresh(accessToken);
         }
     );
-}
\ No newline at end of file
+}
+
+void SpotifyAuth::finishRefresh(std::string const& token) {
+    m_refreshing = false;
+    auto waiters = std::move(m_refreshWaiters);
+    m_refreshWaiters.clear();
+    for (auto& waiter : waiters) waiter(token);
+}
+
+void SpotifyAuth::saveTokens(std::string const& accessToken, std::string const& refreshToken, int64_t expiresIn) {
+    auto now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    Mod::get()->setSavedValue("spotify-token", accessToken);
+    Mod::get()->setSavedValue<int64_t>("spotify-token-expiry", now + expiresIn);
+    if (!refreshToken.empty()) {
+        Mod::get()->setSavedValue("spotify-refresh", refreshToken);
+    }
+    this->scheduleRefresh();
+}
+
+bool SpotifyAuth::isTokenFresh() const {
+    // saved as unix time, so it survives restarts
+    auto expiry = std::chrono::system_clock::time_point(std::chrono::seconds(Mod::get()->getSavedValue<int64_t>("spotify-token-expiry", 0)));
+    return std::chrono::system_clock::now() + REFRESH_MARGIN < expiry;
+}
+
+void SpotifyAuth::scheduleRefresh() {
+    if (m_refreshTimer.isValid()) m_refreshTimer.abort();
+
+    auto expiry = std::chrono::system_clock::time_point(std::chrono::seconds(Mod::get()->getSavedValue<int64_t>("spotify-token-expiry", 0)));
+    auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(expiry - REFRESH_MARGIN - std::chrono::system_clock::now());
+    // never spin on tokens that expire within the margin
+    delay = std::max<std::chrono::milliseconds>(delay, std::chrono::seconds(10));
+
+    m_refreshTimer = async::spawn(
+        arc::sleep(asp::Duration::fromMillis(delay.count())),
+        [this] {
+            queueInMainThread([this] {
+                if (Mod::get()->getSavedValue<bool>("hasAuthorized")) this->refresh(nullptr);
+            });
+        }
+    );
+}
@@ -1,6 +1,12 @@
 #pragma once
 #include "../server/server.h"
 #include <Geode/utils/web.hpp>
+#include <arc/time/Sleep.hpp>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
 
 using namespace geode::prelude;
 
@@ -11,11 +17,51 @@ protected:
     std::function<void(std::string)> m_callback;
     async::TaskHolder<web::WebResponse> m_listener;
     arc::TaskHandle<void> m_timer;
+
+    static constexpr auto CLIENT_ID = "7314a0ab3c734b2caa4b483032cdd91f";
+    static constexpr auto REDIRECT_URI = "http://127.0.0.1:21851/";
+    static constexpr auto SCOPES = "user-read-playback-state user-modify-playback-state";
+    /// @brief PKCE code verifier of the authorization in progress, its SHA-256 goes out with the authorize URL.
+    std::string m_verifier;
+    /// @brief OAuth state of the authorize URL, redirects that don't carry it are refused before their code is exchanged.
+    std::string m_state;
+    async::TaskHolder<web::WebResponse> m_exchange;
+
+    /// @brief In debug builds the "spotify-token-endpoint" saved value overrides it, to test against a local stand-in server.
+    std::string tokenEndpoint() const;
+    web::WebRequest tokenRequest(std::string const& body) const;
+
+    /// @brief Tokens are refreshed this long before they expire, so requests never have to wait for a refresh.
+    static constexpr auto REFRESH_MARGIN = std::chrono::seconds(60);
+    bool m_refreshing = false;
+    std::vector<std::function<void(std::string)>> m_refreshWaiters;
+    arc::TaskHandle<void> m_refreshTimer;
+    void finishRefresh(std::string const& token);
     
 public:
+    /// @brief Wait for the redirect of the authorize URL and pass its code to the callback, on the main thread.
+    /// Only a redirect carrying m_state is accepted.
     void start(std::function<void(std::string)> callback);
     void stop();
-    void refresh(std::function<void(std::string)> callback);
+    /// @brief Link an account: open the authorize page in the browser and exchange the code it redirects back with
+    /// directly at the Spotify token endpoint (authorization code flow with PKCE, no client secret involved).
+    void authorize();
+    /// @brief Trade an authorization code for tokens with the verifier of the last authorize call.
+    void exchangeCode(std::string const& code);
+    /// @brief Whether the stored refresh token was issued to this client through PKCE. Tokens linked through the
+    /// old auth proxy can't be refreshed without it, those accounts have to be linked again.
+    bool hasPkceTokens() const;
+    /// @brief Get a new access token. Concurrent calls share a single request, every callback gets the new token
+    /// (an empty string if the refresh failed). Main thread only.
+    /// @param rejected The token a request was refused with. If a newer token is stored already, it is passed to the
+    /// callback right away instead of refreshing again.
+    void refresh(std::function<void(std::string)> callback, std::string const& rejected = "");
+    /// @brief Store the tokens of a token endpoint response and schedule the next refresh before the new one expires.
+    void saveTokens(std::string const& accessToken, std::string const& refreshToken, int64_t expiresIn);
+    /// @brief Whether the stored access token is valid for longer than the refresh margin.
+    bool isTokenFresh() const;
+    /// @brief Refresh in the background shortly before the stored token expires.
+    void scheduleRefresh();
     
     static SpotifyAuth* get() {
         if (!instance) {
@@ -10,7 +10,7 @@ public:
     std::thread thread;
     std::atomic<bool> running{false};
     std::atomic<bool> shouldStop{false};
-    std::function<void(std::string)> callback;
+    std::function<bool(std::string, std::string)> callback;
     
     ~Impl() {
         shouldStop = true;
@@ -19,13 +19,13 @@ public:
     }
 };
 
-void LocalAuthServer::start(std::function<void(std::string)> onToken) {
+void LocalAuthServer::start(std::function<bool(std::string code, std::string state)> onRedirect) {
     if (m_impl) {
         stop();
     }
     
     m_impl = new Impl();
-    m_impl->callback = onToken;
+    m_impl->callback = onRedirect;
     m_impl->running = true;
     m_impl->shouldStop = false;
     
@@ -38,20 +38,30 @@ void LocalAuthServer::start(std::function<void(std::string)> onToken) {
         
         if (req.has_param("code")) {
             std::string code = req.get_param_value("code");
+            std::string state = req.get_param_value("state");
             
-            res.set_content(
-                "<html><body><h1>Success!</h1><p>You can close this window now.</p></body></html>", 
-                "text/html"
-            );
-            
+            bool accepted = false;
             if (implPtr->callback) {
                 try {
-                    implPtr->callback(code);
+                    accepted = implPtr->callback(code, state);
                 } catch (...) {
                     //TODO
                 }
             }
             
+            if (!accepted) {
+                res.set_content(
+                    "<html><body><h1>Error</h1><p>This authorization wasn't started by the mod.</p></body></html>", 
+                    "text/html"
+                );
+                return;
+            }
+            
+            res.set_content(
+                "<html><body><h1>Success!</h1><p>You can close this window now.</p></body></html>", 
+                "text/html"
+            );
+            
             implPtr->shouldStop = true;
             std::thread([implPtr]() {
                 std::this_thread::sleep_for(std::chrono::milliseconds(500));
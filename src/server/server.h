@@ -4,7 +4,9 @@
 
 class LocalAuthServer {
 public:
-    void start(std::function<void(std::string)> onToken);
+    /// @brief Listen for the authorize redirect. onRedirect gets its code and state on the server thread,
+    /// returning false answers with an error page and keeps listening.
+    void start(std::function<bool(std::string code, std::string state)> onRedirect);
     void stop();
 private:
     class Impl;
@@ -0,0 +1,96 @@
+#pragma once
+#ifdef DEBUG_BUILD
+#include <Geode/Geode.hpp>
+#include "../utils/MemoryStats.hpp"
+
+using namespace geode::prelude;
+
+/// @brief Debug popup listing the memory report of every subsystem (see memory::registerCollector).
+class memoryStatsPopup : public Popup {
+public:
+    static memoryStatsPopup* create() {
+        auto popup = new memoryStatsPopup;
+        if (popup->init()) {
+            popup->autorelease();
+            return popup;
+        }
+        delete popup;
+        return nullptr;
+    }
+
+protected:
+    ScrollLayer* m_scroll = nullptr;
+    CCLabelBMFont* m_statsLabel = nullptr;
+
+    bool init() {
+        if (!Popup::init(380.f, 260.f))
+            return false;
+
+        this->setTitle("Memory Usage");
+
+        m_scroll = ScrollLayer::create({350.f, 170.f});
+        m_mainLayer->addChildAtPosition(m_scroll, Anchor::Center, ccp(-175.f, -80.f));
+
+        m_statsLabel = CCLabelBMFont::create("", "chatFont.fnt");
+        m_statsLabel->setAnchorPoint({0.f, 1.f});
+        m_statsLabel->setScale(0.6f);
+        m_scroll->m_contentLayer->addChild(m_statsLabel);
+
+        auto menu = CCMenu::create();
+        menu->setContentSize({300.f, 30.f});
+        menu->setLayout(RowLayout::create()->setGap(10.f));
+        menu->addChild(CCMenuItemSpriteExtra::create(
+            ButtonSprite::create("Refresh", "goldFont.fnt", "GJ_button_01.png", .7f),
+            this,
+            menu_selector(memoryStatsPopup::onRefresh)
+        ));
+        menu->addChild(CCMenuItemSpriteExtra::create(
+            ButtonSprite::create("Dump JSON", "goldFont.fnt", "GJ_button_01.png", .7f),
+            this,
+            menu_selector(memoryStatsPopup::onDump)
+        ));
+        menu->updateLayout();
+        m_mainLayer->addChildAtPosition(menu, Anchor::Bottom, ccp(0, 25));
+
+        this->updateStats();
+        return true;
+    }
+
+    void updateStats() {
+        auto report = memory::collect();
+
+        size_t total = 0;
+        std::string text;
+        for (auto& subsystem : report) {
+            total += subsystem.getTotalBytes();
+            text += fmt::format("{}: {}\n", subsystem.name, memory::formatBytes(subsystem.getTotalBytes()));
+            for (auto& usage : subsystem.usages) {
+                text += fmt::format("    {}: {} ({})\n", usage.name, memory::formatBytes(usage.bytes), usage.count);
+            }
+        }
+        m_statsLabel->setString(fmt::format("Total: {}\n{}", memory::formatBytes(total), text).c_str());
+
+        // grow the scrolled content to the text, and start at the top
+        auto height = std::max(m_scroll->getContentSize().height, m_statsLabel->getScaledContentSize().height);
+        m_scroll->m_contentLayer->setContentSize({m_scroll->getContentSize().width, height});
+        m_statsLabel->setPosition({5.f, height});
+        m_scroll->scrollToTop();
+    }
+
+    void onRefresh(CCObject*) {
+        this->updateStats();
+    }
+
+    void onDump(CCObject*) {
+        auto path = Mod::get()->getSaveDir() / "memory-report.json";
+        if (auto res = memory::dumpJson(path); res.isErr()) {
+            log::error("Failed to write memory report: {}", res.unwrapErr());
+            Notification::create("Failed to write memory report", NotificationIcon::Error)->show();
+            return;
+        }
+
+        log::info("Memory report written to {}", utils::string::pathToString(path));
+        Notification::create("Saved memory-report.json", NotificationIcon::Success)->show();
+    }
+};
+#endif
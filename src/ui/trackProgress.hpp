@@ -0,0 +1,156 @@
+#pragma once
+#include <Geode/Geode.hpp>
+
+#include <algorithm>
+#include <array>
+
+using namespace geode::prelude;
+
+/// @brief Fixed-width "mm:ss" text. The digit glyphs are cut out of a CCLabelBMFont once, after that changing
+/// the time only swaps the texture rects of the digits that changed: nothing is formatted or laid out again.
+class TimeText : public CCSpriteBatchNode {
+public:
+    static TimeText* create(const char* font) {
+        auto ret = new TimeText;
+        if (ret->init(font)) {
+            ret->autorelease();
+            return ret;
+        }
+        delete ret;
+        return nullptr;
+    }
+
+    void setSeconds(int seconds) {
+        seconds = std::clamp(seconds, 0, 99 * 60 + 59);
+        if (seconds == m_seconds) return;
+        m_seconds = seconds;
+
+        int minutes = seconds / 60;
+        this->setSlot(0, minutes >= 10 ? minutes / 10 : -1);
+        this->setSlot(1, minutes % 10);
+        this->setSlot(2, COLON);
+        this->setSlot(3, seconds % 60 / 10);
+        this->setSlot(4, seconds % 10);
+    }
+
+protected:
+    static constexpr int COLON = 10;
+    static constexpr size_t SLOT_COUNT = 5;
+
+    std::array<CCRect, 11> m_glyphRects;  // 0-9 and ':'
+    std::array<float, 11> m_glyphY = {};
+    std::array<CCSprite*, SLOT_COUNT> m_slots = {};
+    std::array<int, SLOT_COUNT> m_slotGlyphs = {};
+    int m_seconds = -1;
+
+    bool init(const char* font) {
+        auto glyphs = CCLabelBMFont::create("0123456789:", font);
+        if (!glyphs || !CCSpriteBatchNode::initWithTexture(glyphs->getTexture(), SLOT_COUNT))
+            return false;
+
+        // the label tags its glyph sprites with their index in the string
+        float digitWidth = 0.f;
+        for (int i = 0; i <= COLON; i++) {
+            auto glyph = static_cast<CCSprite*>(glyphs->getChildByTag(i));
+            if (!glyph) return false;
+            m_glyphRects[i] = glyph->getTextureRect();
+            m_glyphY[i] = glyph->getPositionY();
+            if (i != COLON) digitWidth = std::max(digitWidth, m_glyphRects[i].size.width);
+        }
+
+        float x = 0.f;
+        for (size_t i = 0; i < SLOT_COUNT; i++) {
+            float width = i == 2 ? m_glyphRects[COLON].size.width : digitWidth;
+            auto slot = CCSprite::createWithTexture(this->getTexture(), m_glyphRects[0]);
+            slot->setPosition({x + width / 2.f, m_glyphY[0]});
+            slot->setVisible(false);
+            this->addChild(slot);
+            m_slots[i] = slot;
+            m_slotGlyphs[i] = -1;
+            x += width + 1.f;
+        }
+        this->setContentSize({x - 1.f, glyphs->getContentSize().height});
+        this->setSeconds(0);
+        return true;
+    }
+
+    void setSlot(size_t slot, int glyph) {
+        if (m_slotGlyphs[slot] == glyph) return;
+        m_slotGlyphs[slot] = glyph;
+
+        auto sprite = m_slots[slot];
+        sprite->setVisible(glyph >= 0);
+        if (glyph < 0) return;
+        sprite->setTextureRect(m_glyphRects[glyph]);
+        sprite->setPositionY(m_glyphY[glyph]);
+    }
+};
+
+/// @brief Track progress bar with the elapsed and total time on its sides. Cheap enough to be updated every frame:
+/// the fill is scaled and the times only change glyphs once a second.
+class TrackProgressBar : public CCNode {
+public:
+    static TrackProgressBar* create(float width) {
+        auto ret = new TrackProgressBar;
+        if (ret->init(width)) {
+            ret->autorelease();
+            return ret;
+        }
+        delete ret;
+        return nullptr;
+    }
+
+    void setProgress(int progressMs, int durationMs) {
+        float ratio = durationMs > 0 ? std::clamp(static_cast<float>(progressMs) / durationMs, 0.f, 1.f) : 0.f;
+        if (ratio != m_fill->getScaleX()) m_fill->setScaleX(ratio);
+        m_elapsed->setSeconds(progressMs / 1000);
+        m_total->setSeconds(durationMs / 1000);
+    }
+
+protected:
+    static constexpr float BAR_HEIGHT = 4.f;
+    static constexpr float TEXT_SCALE = .6f;
+    static constexpr float TEXT_GAP = 6.f;
+
+    CCLayerColor* m_track = nullptr;
+    CCLayerColor* m_fill = nullptr;
+    TimeText* m_elapsed = nullptr;
+    TimeText* m_total = nullptr;
+
+    bool init(float width) {
+        if (!CCNode::init())
+            return false;
+
+        m_elapsed = TimeText::create("chatFont.fnt");
+        m_total = TimeText::create("chatFont.fnt");
+        if (!m_elapsed || !m_total)
+            return false;
+
+        float textWidth = m_elapsed->getContentSize().width * TEXT_SCALE;
+        float height = m_elapsed->getContentSize().height * TEXT_SCALE;
+        float barWidth = width - 2.f * (textWidth + TEXT_GAP);
+        this->setContentSize({width, height});
+        this->setAnchorPoint({0.f, .5f});
+
+        m_elapsed->setScale(TEXT_SCALE);
+        m_elapsed->setAnchorPoint({0.f, .5f});
+        m_elapsed->setPosition({0.f, height / 2.f});
+        this->addChild(m_elapsed);
+
+        m_track = CCLayerColor::create({255, 255, 255, 60}, barWidth, BAR_HEIGHT);
+        m_track->setPosition({textWidth + TEXT_GAP, (height - BAR_HEIGHT) / 2.f});
+        this->addChild(m_track);
+
+        m_fill = CCLayerColor::create({253, 205, 52, 255}, barWidth, BAR_HEIGHT);
+        // scaled from the left edge
+        m_fill->setAnchorPoint({0.f, 0.f});
+        m_fill->setScaleX(0.f);
+        m_track->addChild(m_fill);
+
+        m_total->setScale(TEXT_SCALE);
+        m_total->setAnchorPoint({1.f, .5f});
+        m_total->setPosition({width, height / 2.f});
+        this->addChild(m_total);
+        return true;
+    }
+};
@@ -0,0 +1,20 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+/// @brief The little cryptography the OAuth PKCE flow needs (RFC 7636).
+namespace crypto {
+    /// @brief SHA-256 digest of the data.
+    std::array<uint8_t, 32> sha256(std::string_view data);
+
+    /// @brief Base64url encoding without padding.
+    std::string base64Url(std::span<const uint8_t> data);
+
+    /// @brief Random string of unreserved URL characters from the system's random source, for PKCE code verifiers
+    /// (43 to 128 characters) and OAuth state values.
+    std::string randomToken(size_t length);
+}
@@ -0,0 +1,354 @@
+#include "JsonExtractor.hpp"
+#include <fmt/format.h>
+
+#include <bit>
+#include <charconv>
+
+namespace {
+    using TargetMask = uint64_t;
+
+    bool isWhitespace(char c) {
+        return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+    }
+
+    bool isDelimiter(char c) {
+        return c == ',' || c == '}' || c == ']' || c == ':' || isWhitespace(c);
+    }
+
+    void appendUtf8(std::string& out, char32_t c) {
+        if (c < 0x80) {
+            out += static_cast<char>(c);
+        } else if (c < 0x800) {
+            out += static_cast<char>(0xC0 | (c >> 6));
+            out += static_cast<char>(0x80 | (c & 0x3F));
+        } else if (c < 0x10000) {
+            out += static_cast<char>(0xE0 | (c >> 12));
+            out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (c & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (c >> 18));
+            out += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (c & 0x3F));
+        }
+    }
+}
+
+/// @brief Recursive descent over the wanted paths only. Every value is visited with the mask of the targets
+/// whose path matches the keys leading to it, values without any are skipped.
+class JsonExtractor::Scanner {
+public:
+    Scanner(std::string_view json, std::vector<Target> const& targets)
+      : m_pos(json.data()), m_begin(json.data()), m_end(json.data() + json.size()), m_targets(targets),
+        m_all(targets.size() == MAX_TARGETS ? ~TargetMask(0) : (TargetMask(1) << targets.size()) - 1) {}
+
+    geode::Result<> run() {
+        if (auto res = this->value(m_all, 0); res.isErr()) return res;
+        if (this->done()) return geode::Ok();
+
+        this->skipWhitespace();
+        if (m_pos != m_end) return this->error("Trailing characters");
+        return geode::Ok();
+    }
+
+private:
+    const char* m_pos;
+    const char* m_begin;
+    const char* m_end;
+    std::vector<Target> const& m_targets;
+    TargetMask m_all;
+    TargetMask m_found = 0;
+    std::string m_key; // unescaped key, only used for keys containing escapes
+
+    bool done() const { return m_found == m_all; }
+
+    geode::ErrValue error(std::string_view message) const {
+        return geode::Err(fmt::format("{} at offset {}", message, m_pos - m_begin));
+    }
+
+    void skipWhitespace() {
+        while (m_pos != m_end && isWhitespace(*m_pos)) ++m_pos;
+    }
+
+    /// @brief Targets of the mask whose path ends at this depth.
+    TargetMask leaves(TargetMask mask, size_t depth) const {
+        TargetMask out = 0;
+        for (auto rest = mask; rest; rest &= rest - 1) {
+            auto i = std::countr_zero(rest);
+            if (m_targets[i].depth == depth) out |= TargetMask(1) << i;
+        }
+        return out;
+    }
+
+    /// @brief Targets of the mask whose path continues with the key at this depth.
+    TargetMask children(TargetMask mask, size_t depth, std::string_view key) const {
+        TargetMask out = 0;
+        for (auto rest = mask; rest; rest &= rest - 1) {
+            auto i = std::countr_zero(rest);
+            auto& target = m_targets[i];
+            if (target.depth > depth && target.segments[depth] == key) out |= TargetMask(1) << i;
+        }
+        return out;
+    }
+
+    template <class T>
+    void assign(TargetMask leaves, Kind kind, T const& value) {
+        for (auto rest = leaves & ~m_found; rest; rest &= rest - 1) {
+            auto i = std::countr_zero(rest);
+            if (m_targets[i].kind != kind) continue;
+            *static_cast<std::optional<T>*>(m_targets[i].out) = value;
+            m_found |= TargetMask(1) << i;
+        }
+    }
+
+    geode::Result<> value(TargetMask mask, size_t depth) {
+        this->skipWhitespace();
+        if (!mask) return this->skip();
+        if (m_pos == m_end) return this->error("Unexpected end of input");
+
+        auto leaves = this->leaves(mask, depth);
+        auto inner = mask & ~leaves;
+        switch (*m_pos) {
+            case '{': return inner ? this->object(inner, depth) : this->skip();
+            case '[': return inner ? this->array(inner, depth) : this->skip();
+            case '"': {
+                if (!leaves) return this->skipString();
+                std::string str;
+                if (auto res = this->readString(str); res.isErr()) return res;
+                this->assign(leaves, Kind::String, str);
+                return geode::Ok();
+            }
+            default: break;
+        }
+
+        auto start = m_pos;
+        while (m_pos != m_end && !isDelimiter(*m_pos)) ++m_pos;
+        std::string_view token(start, m_pos - start);
+        if (token == "true" || token == "false") {
+            this->assign(leaves, Kind::Boolean, token == "true");
+        } else if (token == "null") {
+            // leaves the outputs empty
+        } else if (!token.empty() && (token[0] == '-' || (token[0] >= '0' && token[0] <= '9'))) {
+            int64_t number = 0;
+            auto [end, ec] = std::from_chars(token.data(), token.data() + token.size(), number);
+            // fractions and exponents aren't integers
+            if (ec == std::errc() && end == token.data() + token.size()) {
+                this->assign(leaves, Kind::Integer, number);
+            }
+        } else {
+            m_pos = start;
+            return this->error("Unexpected token");
+        }
+        return geode::Ok();
+    }
+
+    geode::Result<> object(TargetMask mask, size_t depth) {
+        ++m_pos; // {
+        this->skipWhitespace();
+        if (m_pos != m_end && *m_pos == '}') {
+            ++m_pos;
+            return geode::Ok();
+        }
+
+        while (true) {
+            this->skipWhitespace();
+            std::string_view key;
+            if (auto res = this->readKey(key); res.isErr()) return res;
+
+            this->skipWhitespace();
+            if (m_pos == m_end || *m_pos != ':') return this->error("Expected ':'");
+            ++m_pos;
+
+            if (auto res = this->value(this->children(mask, depth, key), depth + 1); res.isErr()) return res;
+            if (this->done()) return geode::Ok();
+
+            this->skipWhitespace();
+            if (m_pos == m_end) return this->error("Unterminated object");
+            if (*m_pos == '}') {
+                ++m_pos;
+                return geode::Ok();
+            }
+            if (*m_pos != ',') return this->error("Expected ',' or '}'");
+            ++m_pos;
+        }
+    }
+
+    geode::Result<> array(TargetMask mask, size_t depth) {
+        ++m_pos; // [
+        this->skipWhitespace();
+        if (m_pos != m_end && *m_pos == ']') {
+            ++m_pos;
+            return geode::Ok();
+        }
+
+        char index[24];
+        for (size_t i = 0;; ++i) {
+            auto end = std::to_chars(index, index + sizeof(index), i).ptr;
+            auto children = this->children(mask, depth, std::string_view(index, end - index));
+            if (auto res = this->value(children, depth + 1); res.isErr()) return res;
+            if (this->done()) return geode::Ok();
+
+            this->skipWhitespace();
+            if (m_pos == m_end) return this->error("Unterminated array");
+            if (*m_pos == ']') {
+                ++m_pos;
+                return geode::Ok();
+            }
+            if (*m_pos != ',') return this->error("Expected ',' or ']'");
+            ++m_pos;
+        }
+    }
+
+    /// @brief Read an object key. Keys without escapes are returned as a view into the document.
+    geode::Result<> readKey(std::string_view& key) {
+        if (m_pos == m_end || *m_pos != '"') return this->error("Expected key");
+
+        auto start = m_pos + 1;
+        for (auto it = start; it != m_end; ++it) {
+            if (*it == '\\') break;
+            if (*it == '"') {
+                key = std::string_view(start, it - start);
+                m_pos = it + 1;
+                return geode::Ok();
+            }
+        }
+
+        m_key.clear();
+        if (auto res = this->readString(m_key); res.isErr()) return res;
+        key = m_key;
+        return geode::Ok();
+    }
+
+    geode::Result<> readString(std::string& out) {
+        ++m_pos; // "
+        while (m_pos != m_end) {
+            char c = *m_pos++;
+            if (c == '"') return geode::Ok();
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+
+            if (m_pos == m_end) break;
+            switch (char escape = *m_pos++) {
+                case '"': case '\\': case '/': out += escape; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'u': {
+                    char32_t codepoint = 0;
+                    if (auto res = this->readHex(codepoint); res.isErr()) return res;
+                    // surrogate pair
+                    if (codepoint >= 0xD800 && codepoint < 0xDC00 && m_end - m_pos >= 6 && m_pos[0] == '\\' && m_pos[1] == 'u') {
+                        m_pos += 2;
+                        char32_t low = 0;
+                        if (auto res = this->readHex(low); res.isErr()) return res;
+                        if (low >= 0xDC00 && low < 0xE000) {
+                            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                        } else {
+                            appendUtf8(out, 0xFFFD);
+                            codepoint = low;
+                        }
+                    }
+                    // unpaired surrogates
+                    if (codepoint >= 0xD800 && codepoint < 0xE000) codepoint = 0xFFFD;
+                    appendUtf8(out, codepoint);
+                    break;
+                }
+                default: return this->error("Invalid escape");
+            }
+        }
+        return this->error("Unterminated string");
+    }
+
+    geode::Result<> readHex(char32_t& out) {
+        if (m_end - m_pos < 4) return this->error("Truncated \\u escape");
+        uint32_t value = 0;
+        auto [end, ec] = std::from_chars(m_pos, m_pos + 4, value, 16);
+        if (ec != std::errc() || end != m_pos + 4) return this->error("Invalid \\u escape");
+        m_pos += 4;
+        out = value;
+        return geode::Ok();
+    }
+
+    geode::Result<> skipString() {
+        ++m_pos; // "
+        while (m_pos != m_end) {
+            char c = *m_pos++;
+            if (c == '"') return geode::Ok();
+            if (c == '\\') {
+                if (m_pos == m_end) break;
+                ++m_pos;
+            }
+        }
+        return this->error("Unterminated string");
+    }
+
+    /// @brief Skip a value without looking into it, containers only by matching brackets.
+    geode::Result<> skip() {
+        if (m_pos == m_end) return this->error("Unexpected end of input");
+
+        if (*m_pos == '"') return this->skipString();
+
+        if (*m_pos != '{' && *m_pos != '[') {
+            auto start = m_pos;
+            while (m_pos != m_end && !isDelimiter(*m_pos)) ++m_pos;
+            if (m_pos == start) return this->error("Unexpected token");
+            return geode::Ok();
+        }
+
+        size_t depth = 0;
+        while (m_pos != m_end) {
+            switch (*m_pos) {
+                case '"':
+                    if (auto res = this->skipString(); res.isErr()) return res;
+                    continue;
+                case '{': case '[':
+                    ++depth;
+                    break;
+                case '}': case ']':
+                    if (--depth == 0) {
+                        ++m_pos;
+                        return geode::Ok();
+                    }
+                    break;
+                default: break;
+            }
+            ++m_pos;
+        }
+        return this->error("Unterminated container");
+    }
+};
+
+JsonExtractor& JsonExtractor::string(std::string_view path, std::optional<std::string>& out) {
+    return this->add(path, Kind::String, &out);
+}
+
+JsonExtractor& JsonExtractor::integer(std::string_view path, std::optional<int64_t>& out) {
+    return this->add(path, Kind::Integer, &out);
+}
+
+JsonExtractor& JsonExtractor::boolean(std::string_view path, std::optional<bool>& out) {
+    return this->add(path, Kind::Boolean, &out);
+}
+
+JsonExtractor& JsonExtractor::add(std::string_view path, Kind kind, void* out) {
+    if (m_targets.size() == MAX_TARGETS) return *this;
+
+    Target target{{}, 0, kind, out};
+    while (true) {
+        if (target.depth == MAX_DEPTH) return *this;
+        auto slash = path.find('/');
+        target.segments[target.depth++] = path.substr(0, slash);
+        if (slash == std::string_view::npos) break;
+        path.remove_prefix(slash + 1);
+    }
+    m_targets.push_back(target);
+    return *this;
+}
+
+geode::Result<> JsonExtractor::extract(std::string_view json) {
+    return Scanner(json, m_targets).run();
+}
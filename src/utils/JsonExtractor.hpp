@@ -0,0 +1,54 @@
+#pragma once
+#include <Geode/Result.hpp>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// @brief Pulls a few values out of a JSON document without building a tree. Register the wanted paths, then call
+/// extract: subtrees that lead to none of them are skipped by matching brackets, and scanning stops as soon as every
+/// path was found.
+///
+///     std::optional<std::string> title;
+///     std::optional<int64_t> progress;
+///     JsonExtractor().string("item/name", title).integer("progress_ms", progress).extract(body);
+class JsonExtractor {
+public:
+    /// @brief Paths are object keys and array indices separated by '/', e.g. "item/artists/0/name", and must outlive
+    /// the extractor (string literals in practice). The output is only set if the value at the path has the right type.
+    JsonExtractor& string(std::string_view path, std::optional<std::string>& out);
+    JsonExtractor& integer(std::string_view path, std::optional<int64_t>& out);
+    JsonExtractor& boolean(std::string_view path, std::optional<bool>& out);
+
+    /// @brief Scan the document and fill the outputs of the paths it contains.
+    /// Returns an error for malformed JSON. Skipped subtrees are only checked for balanced brackets and terminated
+    /// strings, and nothing after the last wanted value is checked at all.
+    geode::Result<> extract(std::string_view json);
+
+    /// @brief Maximum number of paths per extractor, and of segments per path. Paths beyond these are ignored.
+    static constexpr size_t MAX_TARGETS = 64;
+    static constexpr size_t MAX_DEPTH = 8;
+
+protected:
+    enum class Kind : uint8_t {
+        String,
+        Integer,
+        Boolean,
+    };
+
+    struct Target {
+        std::array<std::string_view, MAX_DEPTH> segments;
+        size_t depth;
+        Kind kind;
+        void* out;
+    };
+
+    class Scanner;
+
+    JsonExtractor& add(std::string_view path, Kind kind, void* out);
+
+    std::vector<Target> m_targets;
+};
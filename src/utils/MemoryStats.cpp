@@ -0,0 +1,103 @@
+#include "MemoryStats.hpp"
+#include <Geode/Geode.hpp>
+
+#include <map>
+
+namespace memory {
+    static std::map<std::string, Collector>& getCollectors() {
+        static std::map<std::string, Collector> s_collectors;
+        return s_collectors;
+    }
+
+    size_t Subsystem::getTotalBytes() const {
+        size_t total = 0;
+        for (auto& usage : usages) {
+            total += usage.bytes;
+        }
+        return total;
+    }
+
+    void registerCollector(std::string const& subsystem, Collector collector) {
+        getCollectors()[subsystem] = std::move(collector);
+    }
+
+    std::vector<Subsystem> collect() {
+        std::vector<Subsystem> report;
+        for (auto& [name, collector] : getCollectors()) {
+            auto& subsystem = report.emplace_back(Subsystem{name, {}});
+            collector(subsystem.usages);
+        }
+        return report;
+    }
+
+    matjson::Value toJson(std::vector<Subsystem> const& report) {
+        size_t totalBytes = 0;
+        auto subsystems = matjson::Value::array();
+        for (auto& subsystem : report) {
+            auto usages = matjson::Value::array();
+            for (auto& usage : subsystem.usages) {
+                usages.push(matjson::makeObject({
+                    {"name", usage.name},
+                    {"bytes", usage.bytes},
+                    {"count", usage.count},
+                }));
+            }
+
+            auto subsystemBytes = subsystem.getTotalBytes();
+            totalBytes += subsystemBytes;
+            subsystems.push(matjson::makeObject({
+                {"name", subsystem.name},
+                {"totalBytes", subsystemBytes},
+                {"usages", usages},
+            }));
+        }
+
+        return matjson::makeObject({
+            {"totalBytes", totalBytes},
+            {"subsystems", subsystems},
+        });
+    }
+
+    geode::Result<> dumpJson(std::filesystem::path const& path) {
+        return geode::utils::file::writeString(path, toJson(collect()).dump());
+    }
+
+    void collectModTextures(std::vector<Usage>& out) {
+        auto textures = cocos2d::CCTextureCache::sharedTextureCache()->m_pTextures;
+        if (!textures) {
+            return;
+        }
+
+        // resources of the mod resolve to paths containing its ID
+        auto& modID = geode::Mod::get()->getID();
+        cocos2d::CCDictElement* element = nullptr;
+        CCDICT_FOREACH(textures, element) {
+            std::string_view path = element->getStrKey();
+            if (path.find(modID) == std::string_view::npos) {
+                continue;
+            }
+
+            auto texture = static_cast<cocos2d::CCTexture2D*>(element->getObject());
+            out.push_back({std::filesystem::path(path).filename().string(), getTextureBytes(texture), 1});
+        }
+    }
+
+    size_t getTextureBytes(cocos2d::CCTexture2D* texture) {
+        if (!texture) {
+            return 0;
+        }
+
+        return static_cast<size_t>(texture->getPixelsWide()) * texture->getPixelsHigh()
+            * texture->bitsPerPixelForFormat() / 8;
+    }
+
+    std::string formatBytes(size_t bytes) {
+        if (bytes < 1024) {
+            return fmt::format("{} B", bytes);
+        }
+        if (bytes < 1024 * 1024) {
+            return fmt::format("{:.1f} KiB", bytes / 1024.0);
+        }
+        return fmt::format("{:.2f} MiB", bytes / (1024.0 * 1024.0));
+    }
+}
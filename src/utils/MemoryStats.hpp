@@ -0,0 +1,52 @@
+#pragma once
+#include <Geode/Result.hpp>
+#include <matjson.hpp>
+#include <cocos2d.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+/// @brief Memory accounting per subsystem. Nothing is tracked per allocation: every subsystem registers a collector
+/// that measures its current state when a report is made, so the accounting costs nothing until it's used.
+namespace memory {
+    /// @brief Memory used by one part of a subsystem (a font, a texture, all labels...).
+    struct Usage {
+        std::string name;
+        size_t bytes = 0; // approximate heap and texture memory
+        size_t count = 0; // number of objects (glyphs, sprites, textures...)
+    };
+
+    /// @brief All parts of a subsystem, as reported by its collector.
+    struct Subsystem {
+        std::string name;
+        std::vector<Usage> usages;
+
+        size_t getTotalBytes() const;
+    };
+
+    using Collector = std::function<void(std::vector<Usage>& out)>;
+
+    /// @brief Register (or replace) the collector of a subsystem. Collectors are called on the main thread.
+    void registerCollector(std::string const& subsystem, Collector collector);
+
+    /// @brief Run all collectors, sorted by subsystem name.
+    std::vector<Subsystem> collect();
+
+    /// @brief Convert a report to JSON: {"totalBytes": N, "subsystems": [{"name", "totalBytes", "usages": [...]}]}.
+    matjson::Value toJson(std::vector<Subsystem> const& report);
+
+    /// @brief Collect a report and write it as JSON.
+    geode::Result<> dumpJson(std::filesystem::path const& path);
+
+    /// @brief Collector for the textures the mod added to CCTextureCache (font atlases, foxy frames, sprites).
+    void collectModTextures(std::vector<Usage>& out);
+
+    /// @brief Texture memory of a texture, in bytes (mipmaps aren't counted).
+    size_t getTextureBytes(cocos2d::CCTexture2D* texture);
+
+    /// @brief Format a byte count for display (B, KiB or MiB).
+    std::string formatBytes(size_t bytes);
+}
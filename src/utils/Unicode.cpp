@@ -0,0 +1,341 @@
+#include "Unicode.hpp"
+#include "UnicodeTables.hpp"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+
+namespace unicode {
+    // Hangul syllables compose algorithmically instead of through the tables
+    constexpr char32_t HANGUL_S_BASE = 0xAC00;
+    constexpr char32_t HANGUL_L_BASE = 0x1100;
+    constexpr char32_t HANGUL_V_BASE = 0x1161;
+    constexpr char32_t HANGUL_T_BASE = 0x11A7;
+    constexpr char32_t HANGUL_L_COUNT = 19;
+    constexpr char32_t HANGUL_V_COUNT = 21;
+    constexpr char32_t HANGUL_T_COUNT = 28;
+    constexpr char32_t HANGUL_N_COUNT = HANGUL_V_COUNT * HANGUL_T_COUNT;
+    constexpr char32_t HANGUL_S_COUNT = HANGUL_L_COUNT * HANGUL_N_COUNT;
+
+    // first codepoint that can be affected by normalization (U+0300 COMBINING GRAVE ACCENT)
+    constexpr char32_t FIRST_UNSTABLE = 0x0300;
+
+    uint8_t getCombiningClass(char32_t c) {
+        if (c < FIRST_UNSTABLE || c > 0xFFFF) {
+            return 0;
+        }
+
+        auto begin = std::begin(tables::COMBINING_CLASSES);
+        auto end = std::end(tables::COMBINING_CLASSES);
+        auto it = std::upper_bound(begin, end, c, [](char32_t c, tables::CombiningClassRange const& range) {
+            return c < range.first;
+        });
+        if (it == begin) {
+            return 0;
+        }
+
+        --it;
+        return c <= it->last ? it->ccc : 0;
+    }
+
+    char32_t compose(char32_t first, char32_t second) {
+        // hangul LV and LVT syllables
+        if (first >= HANGUL_L_BASE && first < HANGUL_L_BASE + HANGUL_L_COUNT
+            && second >= HANGUL_V_BASE && second < HANGUL_V_BASE + HANGUL_V_COUNT) {
+            return HANGUL_S_BASE + ((first - HANGUL_L_BASE) * HANGUL_V_COUNT + (second - HANGUL_V_BASE)) * HANGUL_T_COUNT;
+        }
+        if (first >= HANGUL_S_BASE && first < HANGUL_S_BASE + HANGUL_S_COUNT
+            && (first - HANGUL_S_BASE) % HANGUL_T_COUNT == 0
+            && second > HANGUL_T_BASE && second < HANGUL_T_BASE + HANGUL_T_COUNT) {
+            return first + (second - HANGUL_T_BASE);
+        }
+
+        if (first > 0xFFFF || second > 0xFFFF) {
+            return 0;
+        }
+
+        auto begin = std::begin(tables::COMPOSITIONS);
+        auto end = std::end(tables::COMPOSITIONS);
+        auto it = std::lower_bound(begin, end, std::pair{first, second}, [](tables::Composition const& entry, auto const& key) {
+            return entry.first < key.first || (entry.first == key.first && entry.second < key.second);
+        });
+        if (it == end || it->first != first || it->second != second) {
+            return 0;
+        }
+
+        return it->composed;
+    }
+
+    static bool needsQuickCheck(char32_t c) {
+        if (c < FIRST_UNSTABLE || c > 0xFFFF) {
+            return false;
+        }
+
+        auto begin = std::begin(tables::NFC_QUICK_CHECK);
+        auto end = std::end(tables::NFC_QUICK_CHECK);
+        auto it = std::upper_bound(begin, end, c, [](char32_t c, tables::CodepointRange const& range) {
+            return c < range.first;
+        });
+        if (it == begin) {
+            return false;
+        }
+
+        --it;
+        return c <= it->last;
+    }
+
+    bool isNormalizedNFC(std::u32string_view text) {
+        for (auto c : text) {
+            if (needsQuickCheck(c)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void normalizeNFC(std::u32string& text) {
+        // skip everything up to the first codepoint that might change
+        size_t start = 0;
+        while (start < text.size() && !needsQuickCheck(text[start])) {
+            ++start;
+        }
+        if (start == text.size()) {
+            return;
+        }
+
+        // the composition needs a starter to work from, so back up to the previous one
+        if (start > 0) {
+            --start;
+        }
+
+        // canonical ordering: stable sort runs of combining marks by their combining class
+        for (size_t i = start; i < text.size();) {
+            if (getCombiningClass(text[i]) == 0) {
+                ++i;
+                continue;
+            }
+
+            size_t runEnd = i;
+            while (runEnd < text.size() && getCombiningClass(text[runEnd]) != 0) {
+                ++runEnd;
+            }
+
+            std::stable_sort(text.begin() + i, text.begin() + runEnd, [](char32_t a, char32_t b) {
+                return getCombiningClass(a) < getCombiningClass(b);
+            });
+            i = runEnd;
+        }
+
+        // canonical composition
+        size_t starterIndex = start;
+        char32_t starter = text[start];
+        int lastClass = getCombiningClass(starter);
+        if (lastClass != 0) {
+            lastClass = 256; // no starter yet, so nothing can compose with it
+        }
+
+        size_t out = start + 1;
+        for (size_t i = start + 1; i < text.size(); ++i) {
+            auto c = text[i];
+            int cc = getCombiningClass(c);
+
+            // combine with the last starter, unless a mark of the same or higher class is in between
+            if (lastClass < cc || lastClass == 0) {
+                if (auto composed = compose(starter, c)) {
+                    text[starterIndex] = composed;
+                    starter = composed;
+                    continue;
+                }
+            }
+
+            if (cc == 0) {
+                starterIndex = out;
+                starter = c;
+            }
+            lastClass = cc;
+            text[out++] = c;
+        }
+
+        text.resize(out);
+    }
+
+    void forEachGlyphAlias(std::function<void(char32_t alias, char32_t target)> const& callback) {
+        for (auto& pair : tables::CASE_PAIRS) {
+            callback(pair.lower, pair.upper);
+            callback(pair.upper, pair.lower);
+        }
+        for (auto& alias : tables::COMPATIBILITY_ALIASES) {
+            callback(alias.variant, alias.base);
+        }
+    }
+
+    struct LineBreakRange {
+        char32_t first;
+        char32_t last;
+        LineBreakClass cls;
+    };
+
+    // Hand-picked subset of LineBreak.txt, sorted by codepoint. Anything not listed is AL.
+    constexpr LineBreakRange LINE_BREAK_RANGES[] = {
+        {0x0021, 0x0021, LineBreakClass::EX}, {0x0022, 0x0022, LineBreakClass::QU}, {0x0024, 0x0024, LineBreakClass::PR},
+        {0x0025, 0x0025, LineBreakClass::PO}, {0x0027, 0x0027, LineBreakClass::QU}, {0x0028, 0x0028, LineBreakClass::OP},
+        {0x0029, 0x0029, LineBreakClass::CL}, {0x002B, 0x002B, LineBreakClass::PR}, {0x002C, 0x002C, LineBreakClass::IS},
+        {0x002D, 0x002D, LineBreakClass::HY}, {0x002E, 0x002E, LineBreakClass::IS}, {0x002F, 0x002F, LineBreakClass::SY},
+        {0x0030, 0x0039, LineBreakClass::NU}, {0x003A, 0x003B, LineBreakClass::IS}, {0x003F, 0x003F, LineBreakClass::EX},
+        {0x005B, 0x005B, LineBreakClass::OP}, {0x005C, 0x005C, LineBreakClass::PR}, {0x005D, 0x005D, LineBreakClass::CL},
+        {0x007B, 0x007B, LineBreakClass::OP}, {0x007C, 0x007C, LineBreakClass::BA}, {0x007D, 0x007D, LineBreakClass::CL},
+        {0x00A0, 0x00A0, LineBreakClass::GL}, {0x00A1, 0x00A1, LineBreakClass::OP}, {0x00A2, 0x00A2, LineBreakClass::PO},
+        {0x00A3, 0x00A5, LineBreakClass::PR}, {0x00AB, 0x00AB, LineBreakClass::QU}, {0x00AD, 0x00AD, LineBreakClass::BA},
+        {0x00B0, 0x00B0, LineBreakClass::PO}, {0x00B1, 0x00B1, LineBreakClass::PR}, {0x00B4, 0x00B4, LineBreakClass::BB},
+        {0x00BB, 0x00BB, LineBreakClass::QU}, {0x00BF, 0x00BF, LineBreakClass::OP},
+        {0x0300, 0x036F, LineBreakClass::CM}, {0x0483, 0x0489, LineBreakClass::CM},
+        // Thai
+        {0x0E01, 0x0E2F, LineBreakClass::SA}, {0x0E30, 0x0E30, LineBreakClass::NS}, {0x0E31, 0x0E31, LineBreakClass::CM},
+        {0x0E32, 0x0E33, LineBreakClass::NS}, {0x0E34, 0x0E3A, LineBreakClass::CM}, {0x0E3F, 0x0E3F, LineBreakClass::PR},
+        {0x0E40, 0x0E44, LineBreakClass::BB}, {0x0E45, 0x0E46, LineBreakClass::NS}, {0x0E47, 0x0E4E, LineBreakClass::CM},
+        {0x0E50, 0x0E59, LineBreakClass::NU}, {0x0E5A, 0x0E5B, LineBreakClass::BA},
+        // Lao
+        {0x0E81, 0x0EB0, LineBreakClass::SA}, {0x0EB1, 0x0EB1, LineBreakClass::CM}, {0x0EB2, 0x0EB3, LineBreakClass::SA},
+        {0x0EB4, 0x0EBC, LineBreakClass::CM}, {0x0EBD, 0x0EC6, LineBreakClass::SA}, {0x0EC8, 0x0ECE, LineBreakClass::CM},
+        {0x0ED0, 0x0ED9, LineBreakClass::NU}, {0x0EDC, 0x0EDF, LineBreakClass::SA},
+        // Myanmar, Khmer
+        {0x1000, 0x109F, LineBreakClass::SA}, {0x1780, 0x17D3, LineBreakClass::SA}, {0x17E0, 0x17E9, LineBreakClass::NU},
+        {0x1AB0, 0x1AFF, LineBreakClass::CM}, {0x1DC0, 0x1DFF, LineBreakClass::CM},
+        // General punctuation
+        {0x2000, 0x2006, LineBreakClass::BA}, {0x2007, 0x2007, LineBreakClass::GL}, {0x2008, 0x200A, LineBreakClass::BA},
+        {0x200B, 0x200B, LineBreakClass::ZW}, {0x200C, 0x200D, LineBreakClass::CM}, {0x2010, 0x2010, LineBreakClass::BA},
+        {0x2011, 0x2011, LineBreakClass::GL}, {0x2012, 0x2014, LineBreakClass::BA}, {0x2018, 0x2019, LineBreakClass::QU},
+        {0x201C, 0x201D, LineBreakClass::QU}, {0x2024, 0x2026, LineBreakClass::NS}, {0x2027, 0x2027, LineBreakClass::BA},
+        {0x202F, 0x202F, LineBreakClass::GL}, {0x2030, 0x2037, LineBreakClass::PO}, {0x2039, 0x203A, LineBreakClass::QU},
+        {0x203C, 0x203D, LineBreakClass::NS}, {0x2044, 0x2044, LineBreakClass::IS}, {0x2060, 0x2060, LineBreakClass::WJ},
+        {0x20A0, 0x20CF, LineBreakClass::PR}, {0x20D0, 0x20FF, LineBreakClass::CM},
+        // CJK symbols and punctuation, kana
+        {0x2E80, 0x2FFF, LineBreakClass::ID}, {0x3000, 0x3000, LineBreakClass::BA}, {0x3001, 0x3002, LineBreakClass::CL},
+        {0x3003, 0x3004, LineBreakClass::ID}, {0x3005, 0x3005, LineBreakClass::NS}, {0x3006, 0x3007, LineBreakClass::ID},
+        {0x3008, 0x3008, LineBreakClass::OP}, {0x3009, 0x3009, LineBreakClass::CL}, {0x300A, 0x300A, LineBreakClass::OP},
+        {0x300B, 0x300B, LineBreakClass::CL}, {0x300C, 0x300C, LineBreakClass::OP}, {0x300D, 0x300D, LineBreakClass::CL},
+        {0x300E, 0x300E, LineBreakClass::OP}, {0x300F, 0x300F, LineBreakClass::CL}, {0x3010, 0x3010, LineBreakClass::OP},
+        {0x3011, 0x3011, LineBreakClass::CL}, {0x3012, 0x3013, LineBreakClass::ID}, {0x3014, 0x3014, LineBreakClass::OP},
+        {0x3015, 0x3015, LineBreakClass::CL}, {0x3016, 0x3016, LineBreakClass::OP}, {0x3017, 0x3017, LineBreakClass::CL},
+        {0x3018, 0x3018, LineBreakClass::OP}, {0x3019, 0x3019, LineBreakClass::CL}, {0x301A, 0x301A, LineBreakClass::OP},
+        {0x301B, 0x301B, LineBreakClass::CL}, {0x301C, 0x301C, LineBreakClass::NS}, {0x301D, 0x301D, LineBreakClass::OP},
+        {0x301E, 0x301F, LineBreakClass::CL}, {0x3020, 0x3029, LineBreakClass::ID}, {0x302A, 0x302F, LineBreakClass::CM},
+        {0x3030, 0x303A, LineBreakClass::ID}, {0x303B, 0x303C, LineBreakClass::NS}, {0x303D, 0x3096, LineBreakClass::ID},
+        {0x3099, 0x309A, LineBreakClass::CM}, {0x309B, 0x309E, LineBreakClass::NS}, {0x309F, 0x309F, LineBreakClass::ID},
+        {0x30A0, 0x30A0, LineBreakClass::NS}, {0x30A1, 0x30FA, LineBreakClass::ID}, {0x30FB, 0x30FE, LineBreakClass::NS},
+        {0x30FF, 0x4DBF, LineBreakClass::ID}, {0x4E00, 0xA4CF, LineBreakClass::ID}, {0xAC00, 0xD7A3, LineBreakClass::ID},
+        {0xF900, 0xFAFF, LineBreakClass::ID}, {0xFE00, 0xFE0F, LineBreakClass::CM}, {0xFE20, 0xFE2F, LineBreakClass::CM},
+        // full-width and half-width forms
+        {0xFF01, 0xFF01, LineBreakClass::EX}, {0xFF02, 0xFF03, LineBreakClass::ID}, {0xFF04, 0xFF04, LineBreakClass::PR},
+        {0xFF05, 0xFF05, LineBreakClass::PO}, {0xFF06, 0xFF07, LineBreakClass::ID}, {0xFF08, 0xFF08, LineBreakClass::OP},
+        {0xFF09, 0xFF09, LineBreakClass::CL}, {0xFF0A, 0xFF0B, LineBreakClass::ID}, {0xFF0C, 0xFF0C, LineBreakClass::CL},
+        {0xFF0D, 0xFF0D, LineBreakClass::ID}, {0xFF0E, 0xFF0E, LineBreakClass::CL}, {0xFF0F, 0xFF19, LineBreakClass::ID},
+        {0xFF1A, 0xFF1B, LineBreakClass::NS}, {0xFF1C, 0xFF1E, LineBreakClass::ID}, {0xFF1F, 0xFF1F, LineBreakClass::EX},
+        {0xFF20, 0xFF3A, LineBreakClass::ID}, {0xFF3B, 0xFF3B, LineBreakClass::OP}, {0xFF3C, 0xFF3C, LineBreakClass::ID},
+        {0xFF3D, 0xFF3D, LineBreakClass::CL}, {0xFF3E, 0xFF5A, LineBreakClass::ID}, {0xFF5B, 0xFF5B, LineBreakClass::OP},
+        {0xFF5C, 0xFF5C, LineBreakClass::ID}, {0xFF5D, 0xFF5D, LineBreakClass::CL}, {0xFF5E, 0xFF5E, LineBreakClass::ID},
+        {0xFF5F, 0xFF5F, LineBreakClass::OP}, {0xFF60, 0xFF61, LineBreakClass::CL}, {0xFF62, 0xFF62, LineBreakClass::OP},
+        {0xFF63, 0xFF64, LineBreakClass::CL}, {0xFF65, 0xFF65, LineBreakClass::NS}, {0xFF9E, 0xFF9F, LineBreakClass::NS},
+        {0xFFE0, 0xFFE0, LineBreakClass::PO}, {0xFFE1, 0xFFE1, LineBreakClass::PR}, {0xFFE5, 0xFFE6, LineBreakClass::PR},
+        // emoji (skin tones and tags attach like marks), supplementary ideographs
+        {0x1F000, 0x1F1E5, LineBreakClass::ID}, {0x1F1E6, 0x1F1FF, LineBreakClass::AL}, {0x1F200, 0x1F3FA, LineBreakClass::ID},
+        {0x1F3FB, 0x1F3FF, LineBreakClass::CM}, {0x1F400, 0x1FAFF, LineBreakClass::ID}, {0x20000, 0x3FFFD, LineBreakClass::ID},
+        {0xE0020, 0xE007F, LineBreakClass::CM}, {0xE0100, 0xE01EF, LineBreakClass::CM},
+    };
+
+    constexpr LineBreakClass findLineBreakClass(char32_t c) {
+        auto begin = std::begin(LINE_BREAK_RANGES);
+        auto end = std::end(LINE_BREAK_RANGES);
+        auto it = std::upper_bound(begin, end, c, [](char32_t c, LineBreakRange const& range) {
+            return c < range.first;
+        });
+        if (it == begin) {
+            return LineBreakClass::AL;
+        }
+
+        --it;
+        return c <= it->last ? it->cls : LineBreakClass::AL;
+    }
+
+    constexpr bool evaluateLineBreakRules(LineBreakClass before, LineBreakClass after) {
+        using enum LineBreakClass;
+
+        // without a dictionary, complex context scripts break like ideographs
+        if (before == SA) before = ID;
+        if (after == SA) after = ID;
+
+        // LB8: break after zero width space
+        if (before == ZW) return true;
+        // LB9: never break before combining marks
+        if (after == CM || after == ZW) return false;
+        // LB11, LB12, LB12a: word joiner and glue
+        if (before == WJ || after == WJ || before == GL) return false;
+        if (after == GL && before != BA && before != HY) return false;
+        // LB13: no break before closing punctuation, exclamation and separators
+        if (after == CL || after == EX || after == IS || after == SY) return false;
+        // LB14: no break after opening punctuation
+        if (before == OP) return false;
+        // LB19: no break around quotation marks
+        if (before == QU || after == QU) return false;
+        // LB21: break-after, hyphens, nonstarters and break-before
+        if (after == BA || after == HY || after == NS || before == BB) return false;
+        // LB23, LB23a, LB24: letters, numbers and their prefixes/postfixes
+        if ((before == AL && after == NU) || (before == NU && after == AL)) return false;
+        if ((before == PR && after == ID) || (before == ID && after == PO)) return false;
+        if ((before == PR || before == PO) && after == AL) return false;
+        if (before == AL && (after == PR || after == PO)) return false;
+        // LB25: numbers
+        if ((before == CL || before == NU) && (after == PO || after == PR)) return false;
+        if ((before == PO || before == PR) && (after == OP || after == NU)) return false;
+        if ((before == HY || before == IS || before == NU || before == SY) && after == NU) return false;
+        // LB28, LB29: letters
+        if ((before == AL || before == IS) && after == AL) return false;
+        // LB30: letters and numbers around parentheses
+        if ((before == AL || before == NU) && after == OP) return false;
+        if (before == CL && (after == AL || after == NU)) return false;
+
+        // LB31: break everywhere else
+        return true;
+    }
+
+    // latin text never leaves these tables, so it costs about as much as splitting at spaces
+    constexpr std::array<LineBreakClass, 0x100> detail::LATIN1_LINE_BREAK_CLASSES = [] {
+        std::array<LineBreakClass, 0x100> classes{};
+        for (char32_t c = 0; c < classes.size(); ++c) {
+            classes[c] = findLineBreakClass(c);
+        }
+        return classes;
+    }();
+    // the Latin fast path of the line splitting relies on it
+    static_assert(std::ranges::none_of(detail::LATIN1_LINE_BREAK_CLASSES, [](LineBreakClass cls) {
+        return cls == LineBreakClass::CM || cls == LineBreakClass::SA;
+    }), "Latin-1 has no combining marks or complex context characters");
+
+    constexpr std::array<std::array<bool, LINE_BREAK_CLASS_COUNT>, LINE_BREAK_CLASS_COUNT> detail::LINE_BREAK_PAIRS = [] {
+        std::array<std::array<bool, LINE_BREAK_CLASS_COUNT>, LINE_BREAK_CLASS_COUNT> pairs{};
+        for (size_t before = 0; before < LINE_BREAK_CLASS_COUNT; ++before) {
+            for (size_t after = 0; after < LINE_BREAK_CLASS_COUNT; ++after) {
+                pairs[before][after] = evaluateLineBreakRules(
+                    static_cast<LineBreakClass>(before), static_cast<LineBreakClass>(after)
+                );
+            }
+        }
+        return pairs;
+    }();
+
+    LineBreakClass getLineBreakClass(char32_t c) {
+        if (c < detail::LATIN1_LINE_BREAK_CLASSES.size()) {
+            return detail::LATIN1_LINE_BREAK_CLASSES[c];
+        }
+        return findLineBreakClass(c);
+    }
+
+    bool isComplexContext(char32_t c) {
+        return (c >= 0x0E00 && c <= 0x0EFF)    // Thai, Lao
+               || (c >= 0x1000 && c <= 0x109F) // Myanmar
+               || (c >= 0x1780 && c <= 0x17FF) // Khmer
+               || (c >= 0x1950 && c <= 0x19DF) // Tai Le, New Tai Lue
+               || (c >= 0x1A20 && c <= 0x1AAF) // Tai Tham
+               || (c >= 0xAA60 && c <= 0xAADF); // Myanmar Extended-A, Tai Viet
+    }
+}
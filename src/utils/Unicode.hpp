@@ -0,0 +1,80 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+/// @brief Small, table-driven Unicode helpers used by the label layout code.
+namespace unicode {
+    /// @brief Get the canonical combining class of a codepoint.
+    uint8_t getCombiningClass(char32_t c);
+
+    /// @brief Compose two codepoints into their canonical primary composite, or return 0 if there is none.
+    char32_t compose(char32_t first, char32_t second);
+
+    /// @brief Quick check whether the text is already in NFC form. ASCII and most precomposed text passes immediately.
+    bool isNormalizedNFC(std::u32string_view text);
+
+    /// @brief Normalize the text to NFC in place. Returns immediately if the text passes the quick check.
+    /// Composition only: precomposed input is not decomposed first, which is enough to map
+    /// "base letter + combining marks" sequences onto the precomposed glyphs in the bundled fonts.
+    void normalizeNFC(std::u32string& text);
+
+    /// @brief Visit every (alias, target) pair a font may use to stand in for a missing glyph:
+    /// simple case mappings in both directions, and compatibility variants (e.g. full-width ASCII) onto their base.
+    void forEachGlyphAlias(std::function<void(char32_t alias, char32_t target)> const& callback);
+
+    /// @brief UAX #14 line break classes. Only the classes that matter for the bundled scripts are distinguished,
+    /// everything else resolves to AL. Spaces and newlines are handled by the caller.
+    enum class LineBreakClass : uint8_t {
+        AL, // alphabetic (default)
+        BA, // break after
+        BB, // break before
+        CL, // closing punctuation
+        CM, // combining mark, attaches to the previous character
+        EX, // exclamation/interrogation
+        GL, // non-breaking (glue)
+        HY, // hyphen
+        ID, // ideographic
+        IS, // infix numeric separator
+        NS, // nonstarter
+        NU, // numeric
+        OP, // opening punctuation
+        PO, // postfix numeric
+        PR, // prefix numeric
+        QU, // quotation
+        SA, // complex context (Thai, Lao, Khmer, Myanmar)
+        SY, // symbols allowing break after
+        WJ, // word joiner
+        ZW, // zero width space
+    };
+
+    constexpr size_t LINE_BREAK_CLASS_COUNT = static_cast<size_t>(LineBreakClass::ZW) + 1;
+
+    namespace detail {
+        // tables behind the inline lookups below, computed from the rules at compile time
+        extern const std::array<LineBreakClass, 0x100> LATIN1_LINE_BREAK_CLASSES;
+        extern const std::array<std::array<bool, LINE_BREAK_CLASS_COUNT>, LINE_BREAK_CLASS_COUNT> LINE_BREAK_PAIRS;
+    }
+
+    /// @brief Get the line break class of a codepoint.
+    LineBreakClass getLineBreakClass(char32_t c);
+
+    /// @brief Get the line break class of a Latin-1 codepoint (below U+0100) with a single table lookup.
+    /// Latin-1 has no combining marks and no complex context characters.
+    inline LineBreakClass getLatin1LineBreakClass(char32_t c) {
+        return detail::LATIN1_LINE_BREAK_CLASSES[c];
+    }
+
+    /// @brief Check whether a line break is allowed between two characters of the given classes (no spaces in between).
+    /// Combining marks must be resolved by the caller (they never allow a break before them).
+    /// SA characters are treated as ID, which is only a fallback since proper breaking needs a dictionary,
+    /// so callers should prefer other break opportunities when SA is involved (see isComplexContext).
+    inline bool isLineBreakAllowed(LineBreakClass before, LineBreakClass after) {
+        return detail::LINE_BREAK_PAIRS[static_cast<size_t>(before)][static_cast<size_t>(after)];
+    }
+
+    /// @brief Whether the codepoint belongs to a script that needs dictionary-based line breaking.
+    bool isComplexContext(char32_t c);
+}
@@ -0,0 +1,294 @@
+#!/usr/bin/env python3
+"""Generates signed distance field variants of the bundled bitmap fonts.
+
+Usage: python3 tools/gen_sdf_fonts.py [font names...]
+
+Reads the uhd bitmap atlas of each font from tools/font_sources (kept out of the package),
+computes a distance field per glyph and packs the result into a single atlas at hd density
+(2 texels per point), written to resources/BitmapFonts/font_<name>.fnt/png.
+No -hd/-uhd variants are shipped for converted fonts, since Label scales distance field fonts
+to every content scale (see BMFontConfiguration::getTextureScale).
+
+Distances are stored in the alpha channel: 0.5 is the glyph edge, and the value changes by 1
+over `distanceRange` texels. Glyph rects include `spread` texels of padding for the falloff,
+which is also what outlines and shadows can use.
+
+Only the standard library is used (PNG decoding/encoding is done by hand).
+"""
+import math
+import os
+import re
+import struct
+import sys
+import zlib
+
+SOURCE_DIR = os.path.join(os.path.dirname(__file__), "font_sources")
+FONT_DIR = os.path.join(os.path.dirname(__file__), "..", "resources", "BitmapFonts")
+
+# fonts converted by default. japanese stays a bitmap font: with distance field padding,
+# its 13k glyphs don't fit in a 4096x4096 texture at hd density
+DEFAULT_FONTS = ["default", "cyrillic", "greek", "thai", "vietnamese"]
+
+TARGET_DENSITY = 2  # texels per point of the generated atlas
+SOURCE_DENSITY = 4  # texels per point of the -uhd atlases
+SPREAD = 4          # distance field falloff around the glyph edge, in output texels
+SPACING = 1         # empty texels between packed glyphs
+INF = 1e20
+
+
+# === PNG ===
+
+def read_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path} is not a PNG file")
+
+    pos = 8
+    idat = b""
+    width = height = 0
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+            if depth != 8 or color != 6 or interlace != 0:
+                raise ValueError(f"{path}: only 8-bit non-interlaced RGBA is supported")
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+
+    raw = zlib.decompress(idat)
+    stride = width * 4
+    alpha = bytearray(width * height)
+    prev = bytearray(stride)
+    offset = 0
+    for y in range(height):
+        kind = raw[offset]
+        line = bytearray(raw[offset + 1:offset + 1 + stride])
+        offset += 1 + stride
+        if kind == 1:
+            for i in range(4, stride):
+                line[i] = (line[i] + line[i - 4]) & 0xFF
+        elif kind == 2:
+            for i in range(stride):
+                line[i] = (line[i] + prev[i]) & 0xFF
+        elif kind == 3:
+            for i in range(stride):
+                left = line[i - 4] if i >= 4 else 0
+                line[i] = (line[i] + ((left + prev[i]) >> 1)) & 0xFF
+        elif kind == 4:
+            for i in range(stride):
+                a = line[i - 4] if i >= 4 else 0
+                b = prev[i]
+                c = prev[i - 4] if i >= 4 else 0
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                if pa <= pb and pa <= pc:
+                    pred = a
+                elif pb <= pc:
+                    pred = b
+                else:
+                    pred = c
+                line[i] = (line[i] + pred) & 0xFF
+        alpha[y * width:(y + 1) * width] = line[3::4]
+        prev = line
+    return width, height, alpha
+
+
+def write_png(path, width, height, alpha):
+    # white glyphs, distance in the alpha channel
+    raw = bytearray()
+    for y in range(height):
+        raw.append(0)
+        for a in alpha[y * width:(y + 1) * width]:
+            raw += bytes((255, 255, 255, a))
+
+    def chunk(kind, payload):
+        crc = zlib.crc32(kind + payload) & 0xFFFFFFFF
+        return struct.pack(">I", len(payload)) + kind + payload + struct.pack(">I", crc)
+
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 6, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+# === FNT ===
+
+def parse_fnt(path):
+    font = {"info": {}, "common": {}, "chars": [], "kernings": []}
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            parts = line.split(None, 1)
+            if not parts:
+                continue
+            kind = parts[0]
+            values = dict(re.findall(r'(\w+)=("[^"]*"|\S+)', parts[1] if len(parts) > 1 else ""))
+            if kind in ("info", "common"):
+                font[kind] = values
+            elif kind == "char":
+                font["chars"].append({k: float(v) if "." in v else int(v) for k, v in values.items()})
+            elif kind == "kerning":
+                font["kernings"].append((int(values["first"]), int(values["second"]), float(values["amount"])))
+    return font
+
+
+def fmt(value):
+    return f"{value:.6f}".rstrip("0").rstrip(".") if isinstance(value, float) else str(value)
+
+
+# === Distance field ===
+
+def edt_1d(f, n):
+    # Felzenszwalb & Huttenlocher squared distance transform of a sampled function
+    d = [0.0] * n
+    v = [0] * n
+    z = [0.0] * (n + 1)
+    k = 0
+    z[0] = -INF
+    z[1] = INF
+    for q in range(1, n):
+        s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k])
+        while s <= z[k]:
+            k -= 1
+            s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k])
+        k += 1
+        v[k] = q
+        z[k] = s
+        z[k + 1] = INF
+    k = 0
+    for q in range(n):
+        while z[k + 1] < q:
+            k += 1
+        d[q] = (q - v[k]) ** 2 + f[v[k]]
+    return d
+
+
+def edt_2d(grid, width, height):
+    # squared distance to the nearest zero cell
+    for x in range(width):
+        column = edt_1d([grid[y * width + x] for y in range(height)], height)
+        for y in range(height):
+            grid[y * width + x] = column[y]
+    for y in range(height):
+        grid[y * width:(y + 1) * width] = edt_1d(grid[y * width:(y + 1) * width], width)
+    return grid
+
+
+def glyph_field(alpha, atlas_width, char, scale):
+    """Distance field of a glyph, in output texels, including SPREAD texels of padding."""
+    margin = SPREAD * scale
+    width = char["width"] + margin * 2
+    height = char["height"] + margin * 2
+
+    inside = [0.0] * (width * height)
+    outside = [0.0] * (width * height)
+    for y in range(height):
+        sy = char["y"] + y - margin
+        for x in range(width):
+            sx = char["x"] + x - margin
+            covered = 0 <= x - margin < char["width"] and 0 <= y - margin < char["height"] \
+                and alpha[sy * atlas_width + sx] >= 128
+            i = y * width + x
+            # distance to the outside for covered cells, and to the inside for empty ones
+            inside[i] = INF if covered else 0.0
+            outside[i] = 0.0 if covered else INF
+    edt_2d(inside, width, height)
+    edt_2d(outside, width, height)
+
+    # average the signed distance over each output texel
+    out_width = (width + scale - 1) // scale
+    out_height = (height + scale - 1) // scale
+    field = bytearray(out_width * out_height)
+    for oy in range(out_height):
+        for ox in range(out_width):
+            total = 0.0
+            count = 0
+            for y in range(oy * scale, min(height, (oy + 1) * scale)):
+                for x in range(ox * scale, min(width, (ox + 1) * scale)):
+                    i = y * width + x
+                    # half a texel between the centers of neighbouring inside/outside cells
+                    if inside[i] > 0:
+                        total += math.sqrt(inside[i]) - 0.5
+                    else:
+                        total -= math.sqrt(outside[i]) - 0.5
+                    count += 1
+            distance = total / count / scale
+            value = 0.5 + distance / (2 * SPREAD)
+            field[oy * out_width + ox] = max(0, min(255, round(value * 255)))
+    return out_width, out_height, field
+
+
+# === Packing ===
+
+def pack(glyphs, max_width=4096):
+    # shelf packing, tallest glyphs first
+    order = sorted(range(len(glyphs)), key=lambda i: -glyphs[i][1])
+    area = sum((w + SPACING) * (h + SPACING) for w, h, _ in glyphs)
+    width = min(max_width, max(max(w for w, _, _ in glyphs), math.ceil(math.sqrt(area * 1.1))))
+
+    positions = [None] * len(glyphs)
+    x = y = shelf = 0
+    for i in order:
+        w, h, _ = glyphs[i]
+        if x + w > width:
+            x = 0
+            y += shelf + SPACING
+            shelf = 0
+        positions[i] = (x, y)
+        x += w + SPACING
+        shelf = max(shelf, h)
+    return width, y + shelf, positions
+
+
+def convert(name):
+    font = parse_fnt(os.path.join(SOURCE_DIR, f"font_{name}-uhd.fnt"))
+    atlas_width, _, alpha = read_png(os.path.join(SOURCE_DIR, f"font_{name}-uhd.png"))
+    scale = SOURCE_DENSITY // TARGET_DENSITY
+
+    glyphs = [glyph_field(alpha, atlas_width, char, scale) for char in font["chars"]]
+    width, height, positions = pack(glyphs)
+
+    atlas = bytearray(width * height)
+    for (w, h, field), (x, y) in zip(glyphs, positions):
+        for row in range(h):
+            atlas[(y + row) * width + x:(y + row) * width + x + w] = field[row * w:(row + 1) * w]
+
+    common = font["common"]
+    info = font["info"]
+    lines = [
+        f'info face={info.get("face", chr(34) * 2)} size={int(info["size"]) // scale} bold=0 italic=0 charset="" '
+        f'unicode=1 stretchH=100 smooth=1 aa=1 padding={SPREAD},{SPREAD},{SPREAD},{SPREAD} spacing={SPACING},{SPACING}',
+        f'common lineHeight={fmt(float(common["lineHeight"]) / scale)} base={int(common["base"]) // scale} '
+        f'scaleW={width} scaleH={height} pages=1 packed=0',
+        f'page id=0 file="font_{name}.png"',
+        f'distanceField fieldType=sdf distanceRange={SPREAD * 2} contentScale={TARGET_DENSITY}',
+        f'chars count={len(glyphs)}',
+    ]
+    for char, (w, h, _), (x, y) in zip(font["chars"], glyphs, positions):
+        lines.append(
+            f'char id={char["id"]} x={x} y={y} width={w} height={h} '
+            f'xoffset={fmt(char["xoffset"] / scale - SPREAD)} yoffset={fmt(char["yoffset"] / scale - SPREAD)} '
+            f'xadvance={fmt(char["xadvance"] / scale)} page=0 chnl=15'
+        )
+    lines.append(f"kernings count={len(font['kernings'])}")
+    for first, second, amount in font["kernings"]:
+        lines.append(f"kerning first={first} second={second} amount={fmt(amount / scale)}")
+
+    with open(os.path.join(FONT_DIR, f"font_{name}.fnt"), "w", encoding="utf-8") as f:
+        f.write("\n".join(lines) + "\n")
+    write_png(os.path.join(FONT_DIR, f"font_{name}.png"), width, height, atlas)
+    print(f"font_{name}: {len(glyphs)} glyphs, {width}x{height}", file=sys.stderr)
+
+
+def main():
+    for name in sys.argv[1:] or DEFAULT_FONTS:
+        convert(name)
+
+
+if __name__ == "__main__":
+    main()
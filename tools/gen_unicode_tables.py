@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""Generates src/utils/UnicodeTables.hpp from Python's unicodedata module.
+
+Usage: python3 tools/gen_unicode_tables.py > src/utils/UnicodeTables.hpp
+
+Only the Basic Multilingual Plane is covered, which is everything the bundled fonts can render.
+"""
+import sys
+import unicodedata
+
+BMP = range(0x10000)
+
+
+def is_hangul(cp):
+    return 0xAC00 <= cp <= 0xD7A3 or 0x1100 <= cp <= 0x11FF
+
+
+def compositions():
+    pairs = []
+    for cp in BMP:
+        if is_hangul(cp):
+            continue
+        decomp = unicodedata.decomposition(chr(cp))
+        if not decomp or decomp.startswith("<"):
+            continue
+        parts = [int(x, 16) for x in decomp.split()]
+        if len(parts) != 2 or max(parts) > 0xFFFF:
+            continue
+        # skip composition exclusions, singletons and non-starter decompositions
+        if unicodedata.normalize("NFC", chr(parts[0]) + chr(parts[1])) != chr(cp):
+            continue
+        pairs.append((parts[0], parts[1], cp))
+    return sorted(pairs)
+
+
+def combining_classes():
+    ranges = []
+    for cp in BMP:
+        ccc = unicodedata.combining(chr(cp))
+        if not ccc:
+            continue
+        if ranges and ranges[-1][1] == cp - 1 and ranges[-1][2] == ccc:
+            ranges[-1][1] = cp
+        else:
+            ranges.append([cp, cp, ccc])
+    return ranges
+
+
+def quick_check_ranges(pairs):
+    # codepoints whose NFC quick check value is not "Yes", plus all combining marks (which may need reordering)
+    seconds = {second for _, second, _ in pairs}
+    flagged = []
+    for cp in BMP:
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        c = chr(cp)
+        if cp in seconds or unicodedata.combining(c) or unicodedata.normalize("NFC", c) != c:
+            flagged.append(cp)
+        elif 0x1161 <= cp <= 0x11C2:  # hangul vowels and trailing consonants compose algorithmically
+            flagged.append(cp)
+    ranges = []
+    for cp in flagged:
+        if ranges and ranges[-1][1] == cp - 1:
+            ranges[-1][1] = cp
+        else:
+            ranges.append([cp, cp])
+    return ranges
+
+
+def case_pairs():
+    pairs = []
+    for cp in BMP:
+        c = chr(cp)
+        lower = c.lower()
+        if lower == c or len(lower) != 1 or ord(lower) > 0xFFFF:
+            continue
+        if lower.upper() != c:
+            continue
+        pairs.append((ord(lower), cp))
+    return sorted(pairs)
+
+
+def compatibility_aliases():
+    # full-width/half-width forms and other single codepoint compatibility variants
+    aliases = []
+    for cp in BMP:
+        decomp = unicodedata.decomposition(chr(cp))
+        if not decomp.startswith(("<wide>", "<narrow>", "<font>", "<compat>", "<noBreak>")):
+            continue
+        parts = decomp.split()[1:]
+        if len(parts) != 1:
+            continue
+        target = int(parts[0], 16)
+        if target > 0xFFFF or target == cp:
+            continue
+        aliases.append((cp, target))
+    aliases.append((0x3000, 0x0020))  # ideographic space
+    return sorted(aliases)
+
+
+def emit_rows(items, fmt, per_line):
+    lines = []
+    for i in range(0, len(items), per_line):
+        lines.append("    " + " ".join(fmt(x) for x in items[i:i + per_line]))
+    return "\n".join(lines)
+
+
+def main():
+    out = sys.stdout
+    pairs = compositions()
+    ccc = combining_classes()
+    qc = quick_check_ranges(pairs)
+
+    out.write("#pragma once\n")
+    out.write("// Generated by tools/gen_unicode_tables.py from Unicode {}. Do not edit by hand.\n\n".format(
+        unicodedata.unidata_version))
+    out.write("#include <cstdint>\n\n")
+    out.write("namespace unicode::tables {\n\n")
+
+    out.write("struct Composition {\n    char16_t first;\n    char16_t second;\n    char16_t composed;\n};\n\n")
+    out.write("struct CombiningClassRange {\n    char16_t first;\n    char16_t last;\n    uint8_t ccc;\n};\n\n")
+    out.write("struct CodepointRange {\n    char16_t first;\n    char16_t last;\n};\n\n")
+    out.write("struct CasePair {\n    char16_t lower;\n    char16_t upper;\n};\n\n")
+    out.write("struct Alias {\n    char16_t variant;\n    char16_t base;\n};\n\n")
+
+    out.write("/// @brief Canonical primary compositions, sorted by (first, second).\n")
+    out.write("inline constexpr Composition COMPOSITIONS[] = {\n")
+    out.write(emit_rows(pairs, lambda p: "{{0x{:04X}, 0x{:04X}, 0x{:04X}}},".format(*p), 4))
+    out.write("\n};\n\n")
+
+    out.write("/// @brief Ranges of codepoints with a non-zero canonical combining class.\n")
+    out.write("inline constexpr CombiningClassRange COMBINING_CLASSES[] = {\n")
+    out.write(emit_rows(ccc, lambda r: "{{0x{:04X}, 0x{:04X}, {}}},".format(*r), 4))
+    out.write("\n};\n\n")
+
+    out.write("/// @brief Ranges of codepoints that may change under NFC (quick check is not \"Yes\", or needs reordering).\n")
+    out.write("inline constexpr CodepointRange NFC_QUICK_CHECK[] = {\n")
+    out.write(emit_rows(qc, lambda r: "{{0x{:04X}, 0x{:04X}}},".format(*r), 6))
+    out.write("\n};\n\n")
+
+    out.write("/// @brief Simple case mappings as (lowercase, uppercase) pairs, sorted by lowercase codepoint.\n")
+    out.write("inline constexpr CasePair CASE_PAIRS[] = {\n")
+    out.write(emit_rows(case_pairs(), lambda p: "{{0x{:04X}, 0x{:04X}}},".format(*p), 6))
+    out.write("\n};\n\n")
+
+    out.write("/// @brief Compatibility variants (full-width, half-width, ...) as (variant, base) pairs.\n")
+    out.write("inline constexpr Alias COMPATIBILITY_ALIASES[] = {\n")
+    out.write(emit_rows(compatibility_aliases(), lambda p: "{{0x{:04X}, 0x{:04X}}},".format(*p), 6))
+    out.write("\n};\n\n")
+
+    out.write("}\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""Repacks bundled bitmap font atlases with transparent padding around every glyph.
+
+Usage: python3 tools/pad_bitmap_fonts.py [atlas names...]
+
+Label draws outlines and drop shadows by sampling the atlas around each glyph, so the reach of
+those effects is capped by the empty texels between neighbouring glyphs
+(see BMFontConfiguration::getEffectReach). Atlases packed with padding=0 and spacing=1 only
+leave half a texel. This rewrites resources/BitmapFonts/<name>.fnt/png in place with PADDING
+texels on every side of each glyph; the glyph rects and offsets grow accordingly, so layout
+is unchanged. Fonts converted to distance fields by gen_sdf_fonts.py already have padding.
+
+Only the standard library is used (PNG codec and packing are shared with gen_sdf_fonts.py).
+"""
+import os
+import sys
+
+from gen_sdf_fonts import FONT_DIR, fmt, pack, parse_fnt, read_png, write_png
+
+# bitmap fonts that aren't converted to distance fields, with every density they ship at
+DEFAULT_ATLASES = ["font_japanese", "font_japanese-hd"]
+
+PADDING = 2  # transparent texels added on every side of a glyph
+
+
+def pad(name):
+    fnt_path = os.path.join(FONT_DIR, f"{name}.fnt")
+    font = parse_fnt(fnt_path)
+    info = font["info"]
+    if any(int(value) != 0 for value in info.get("padding", "0,0,0,0").split(",")):
+        print(f"{name}: already padded, skipped", file=sys.stderr)
+        return
+
+    atlas_width, _, alpha = read_png(os.path.join(FONT_DIR, f"{name}.png"))
+
+    glyphs = []
+    for char in font["chars"]:
+        w = char["width"] + PADDING * 2
+        h = char["height"] + PADDING * 2
+        pixels = bytearray(w * h)
+        for row in range(char["height"]):
+            source = (char["y"] + row) * atlas_width + char["x"]
+            start = (row + PADDING) * w + PADDING
+            pixels[start:start + char["width"]] = alpha[source:source + char["width"]]
+        glyphs.append((w, h, pixels))
+
+    width, height, positions = pack(glyphs)
+    if width > 4096 or height > 4096:
+        raise ValueError(f"{name}: padded atlas is {width}x{height}, larger than 4096x4096")
+
+    atlas = bytearray(width * height)
+    for (w, h, pixels), (x, y) in zip(glyphs, positions):
+        for row in range(h):
+            atlas[(y + row) * width + x:(y + row) * width + x + w] = pixels[row * w:(row + 1) * w]
+
+    # keep every key of the original header, only the padding and the atlas size change
+    header = []
+    with open(fnt_path, encoding="utf-8") as f:
+        for line in f:
+            kind = line.split(None, 1)[0] if line.strip() else ""
+            if kind in ("char", "kerning", "chars", "kernings"):
+                continue
+            line = line.rstrip("\n")
+            if kind == "info":
+                line = line.replace("padding=0,0,0,0", f"padding={PADDING},{PADDING},{PADDING},{PADDING}")
+            elif kind == "common":
+                line = line.replace(f"scaleW={font['common']['scaleW']}", f"scaleW={width}")
+                line = line.replace(f"scaleH={font['common']['scaleH']}", f"scaleH={height}")
+            header.append(line)
+
+    lines = header + [f"chars count={len(glyphs)}"]
+    for char, (w, h, _), (x, y) in zip(font["chars"], glyphs, positions):
+        lines.append(
+            f'char id={char["id"]} x={x} y={y} width={w} height={h} '
+            f'xoffset={fmt(char["xoffset"] - PADDING)} yoffset={fmt(char["yoffset"] - PADDING)} '
+            f'xadvance={fmt(char["xadvance"])} page=0 chnl=15'
+        )
+    lines.append(f"kernings count={len(font['kernings'])}")
+    for first, second, amount in font["kernings"]:
+        lines.append(f"kerning first={first} second={second} amount={fmt(amount)}")
+
+    with open(fnt_path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines) + "\n")
+    write_png(os.path.join(FONT_DIR, f"{name}.png"), width, height, atlas)
+    print(f"{name}: {len(glyphs)} glyphs, {width}x{height}", file=sys.stderr)
+
+
+def main():
+    for name in sys.argv[1:] or DEFAULT_ATLASES:
+        pad(name)
+
+
+if __name__ == "__main__":
+    main()